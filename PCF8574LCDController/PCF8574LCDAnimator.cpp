@@ -0,0 +1,12 @@
+/*
+ Name:		PCF8574LCDAnimator.cpp
+ Created:	17/10/2026 03:02:51 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDAnimator.h"
+
+template class BasicPCF8574LCDAnimator<PCF8574LCDController>;
+template class BasicPCF8574LCDAnimator<PCF8574BufferedLCDController>;
@@ -0,0 +1,310 @@
+/*
+ Name:		PCF8574LCDAnimator.h
+ Created:	17/10/2026 03:02:51 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDAnimator_h
+#define _PCF8574LCDAnimator_h
+
+#include "PCF8574LCDController.h"
+
+/// <summary>
+/// Animator of custom chars of given display type (spinners, activity indicators, signal bars). Each CGRAM slot may play its own sequence
+/// of frames stored in program memory (PROGMEM), with its own frame interval. New frame is written only to CGRAM, so it changes
+/// every char on display showing this slot, without sending anything to DDRAM. Frames with the same data as frame already in CGRAM
+/// are not sent, and frames of adjacent slots changed at the same update are sent in one auto-increment burst.
+/// Slots not used by animations stay free for other custom chars.
+/// </summary>
+template<typename Display>
+class BasicPCF8574LCDAnimator final
+{
+public:
+	/// <summary>
+	/// Starts playing frames in given slot. First frame is written to CGRAM by next update.
+	/// </summary>
+	/// <param name="slot">Slot number (0-7 for 5x8 font, 0-3 for 5x10 font)</param>
+	/// <param name="frames">Frames in program memory, one after another, 8 bytes each for 5x8 font or 11 bytes for 5x10 font</param>
+	/// <param name="framesCount">Number of frames</param>
+	/// <param name="frameInterval">Time of one frame in milliseconds</param>
+	/// <param name="repeat">True to play frames in loop, false to stop at last frame</param>
+	/// <returns>True if animation was started</returns>
+	bool play(const uint8_t& slot, const uint8_t frames[], const uint8_t& framesCount, const uint16_t& frameInterval, const bool& repeat = true);
+
+	/// <summary>
+	/// Stops animation in given slot. Current frame stays in CGRAM.
+	/// </summary>
+	/// <param name="slot">Slot number</param>
+	void stop(const uint8_t& slot) { if (slot < m_slotsCount) m_runningSlots &= ~(1 << slot); }
+
+	/// <summary>
+	/// Stops all animations. Current frames stay in CGRAM.
+	/// </summary>
+	void stopAll(void) { m_runningSlots = 0; }
+
+	/// <summary>
+	/// Checks if animation plays in given slot.
+	/// </summary>
+	/// <param name="slot">Slot number</param>
+	/// <returns>True if animation plays</returns>
+	bool isPlaying(const uint8_t& slot) { return slot < m_slotsCount && (m_runningSlots & (1 << slot)); }
+
+	/// <summary>
+	/// Moves animations whose frame interval passed to next frame and writes changed frames to CGRAM. Never waits for next frame.
+	/// </summary>
+	/// <returns>Number of slots written to CGRAM</returns>
+	uint8_t update(void);
+
+	/// <summary>
+	/// Forgets which frames are in CGRAM, so current frames of all animations are written again by next update.
+	/// Use it after CGRAM was changed without animator.
+	/// </summary>
+	void invalidate(void);
+
+	/// <summary>
+	/// Returns char code displaying given slot.
+	/// </summary>
+	/// <param name="slot">Slot number</param>
+	/// <returns>Char code</returns>
+	uint8_t getCharCode(const uint8_t& slot) { return m_slotsCount == 8 ? slot : slot << 1; }
+
+	/// <summary>
+	/// Returns number of CGRAM slots.
+	/// </summary>
+	/// <returns>Number of slots</returns>
+	uint8_t getSlotsCount(void) { return m_slotsCount; }
+
+	/// <summary>
+	/// Constructor for animator. Font of display is read from its function set.
+	/// </summary>
+	/// <param name="display">Display with CGRAM used by animator</param>
+	BasicPCF8574LCDAnimator(Display& display);
+
+	BasicPCF8574LCDAnimator(const BasicPCF8574LCDAnimator&) = delete;
+	BasicPCF8574LCDAnimator& operator=(const BasicPCF8574LCDAnimator&) = delete;
+
+private:
+	/// <summary>
+	/// Animation played in one slot.
+	/// </summary>
+	struct Animation
+	{
+		/// <summary>
+		/// Frames in program memory, nullptr if slot has no animation.
+		/// </summary>
+		const uint8_t* frames;
+
+		/// <summary>
+		/// Frame data in CGRAM, nullptr if it is not known.
+		/// </summary>
+		const uint8_t* writtenFrame;
+
+		/// <summary>
+		/// Time in milliseconds when current frame was due.
+		/// </summary>
+		unsigned long lastFrameTime;
+
+		/// <summary>
+		/// Time of one frame in milliseconds.
+		/// </summary>
+		uint16_t frameInterval;
+
+		uint8_t framesCount;
+		uint8_t currentFrame;
+	};
+
+	/// <summary>
+	/// Display with CGRAM used by animator.
+	/// </summary>
+	Display& m_display;
+
+	/// <summary>
+	/// Number of CGRAM slots.
+	/// </summary>
+	const uint8_t m_slotsCount;
+
+	/// <summary>
+	/// Number of bytes in frame.
+	/// </summary>
+	const uint8_t m_frameSize;
+
+	/// <summary>
+	/// Animation of each slot.
+	/// </summary>
+	Animation m_animations[8] = {};
+
+	/// <summary>
+	/// One bit for each slot, set if animation plays.
+	/// </summary>
+	uint8_t m_runningSlots = 0;
+
+	/// <summary>
+	/// One bit for each slot, set if animation plays in loop.
+	/// </summary>
+	uint8_t m_repeatedSlots = 0;
+
+	/// <summary>
+	/// One bit for each slot, set if current frame waits for writing to CGRAM.
+	/// </summary>
+	uint8_t m_pendingSlots = 0;
+
+private:
+	/// <summary>
+	/// Returns number of CGRAM bytes used by one slot.
+	/// </summary>
+	/// <returns>Size of slot</returns>
+	uint8_t getSlotSize(void) { return 64 / m_slotsCount; }
+
+	/// <summary>
+	/// Returns current frame of given slot.
+	/// </summary>
+	/// <param name="slot">Slot number</param>
+	/// <returns>Frame data in program memory</returns>
+	const uint8_t* getCurrentFrame(const uint8_t& slot) { return &m_animations[slot].frames[m_animations[slot].currentFrame * m_frameSize]; }
+
+	/// <summary>
+	/// Marks current frame of given slot for writing, unless CGRAM already holds the same data.
+	/// </summary>
+	/// <param name="slot">Slot number</param>
+	void requestFrame(const uint8_t& slot);
+
+	/// <summary>
+	/// Writes pending frames of adjacent slots to CGRAM in one burst.
+	/// </summary>
+	/// <param name="firstSlot">First slot of run</param>
+	/// <param name="lastSlot">Last slot of run</param>
+	void writeFrames(const uint8_t& firstSlot, const uint8_t& lastSlot);
+};
+
+template<typename Display>
+BasicPCF8574LCDAnimator<Display>::BasicPCF8574LCDAnimator(Display& display) :
+	m_display(display), m_slotsCount(display.getCurrentFunctionSet() & 0x04 ? 4 : 8), m_frameSize(display.getCurrentFunctionSet() & 0x04 ? 11 : 8)
+{
+}
+
+template<typename Display>
+bool BasicPCF8574LCDAnimator<Display>::play(const uint8_t& slot, const uint8_t frames[], const uint8_t& framesCount, const uint16_t& frameInterval, const bool& repeat)
+{
+	if (slot >= m_slotsCount || frames == nullptr || !framesCount) return false;
+
+	Animation& animation = m_animations[slot];
+	animation.frames = frames;
+	animation.framesCount = framesCount;
+	animation.frameInterval = frameInterval;
+	animation.currentFrame = 0;
+	animation.lastFrameTime = millis();
+
+	m_runningSlots |= 1 << slot;
+	if (repeat) m_repeatedSlots |= 1 << slot;
+	else m_repeatedSlots &= ~(1 << slot);
+
+	requestFrame(slot);
+	return true;
+}
+
+template<typename Display>
+uint8_t BasicPCF8574LCDAnimator<Display>::update(void)
+{
+	const unsigned long currentTime = millis();
+
+	for (uint8_t slot = 0; slot < m_slotsCount; slot++)
+	{
+		Animation& animation = m_animations[slot];
+		if (!(m_runningSlots & (1 << slot)) || currentTime - animation.lastFrameTime < animation.frameInterval) continue;
+
+		animation.lastFrameTime += animation.frameInterval;
+		if (currentTime - animation.lastFrameTime >= animation.frameInterval) animation.lastFrameTime = currentTime;//frames that were missed are skipped
+
+		if (animation.currentFrame + 1 < animation.framesCount) animation.currentFrame++;
+		else if (m_repeatedSlots & (1 << slot)) animation.currentFrame = 0;
+		else
+		{
+			m_runningSlots &= ~(1 << slot);//last frame stays in CGRAM
+			continue;
+		}
+
+		requestFrame(slot);
+	}
+
+	if (!m_pendingSlots) return 0;
+
+	uint8_t writtenSlots = 0;
+	for (uint8_t slot = 0; slot < m_slotsCount; slot++)
+	{
+		if (!(m_pendingSlots & (1 << slot))) continue;
+
+		uint8_t lastSlot = slot;
+		while (lastSlot + 1 < m_slotsCount && (m_pendingSlots & (1 << (lastSlot + 1)))) lastSlot++;
+
+		writeFrames(slot, lastSlot);
+		writtenSlots += lastSlot - slot + 1;
+		slot = lastSlot;
+	}
+
+	m_display.sendBufferedData();
+	m_pendingSlots = 0;
+	return writtenSlots;
+}
+
+template<typename Display>
+void BasicPCF8574LCDAnimator<Display>::invalidate(void)
+{
+	for (uint8_t slot = 0; slot < m_slotsCount; slot++)
+	{
+		m_animations[slot].writtenFrame = nullptr;
+		if (m_animations[slot].frames != nullptr) m_pendingSlots |= 1 << slot;
+	}
+}
+
+template<typename Display>
+void BasicPCF8574LCDAnimator<Display>::requestFrame(const uint8_t& slot)
+{
+	const uint8_t* frame = getCurrentFrame(slot);
+	const uint8_t* writtenFrame = m_animations[slot].writtenFrame;
+
+	bool sameData = writtenFrame != nullptr;
+	for (uint8_t i = 0; sameData && frame != writtenFrame && i < m_frameSize; i++) sameData = pgm_read_byte(&frame[i]) == pgm_read_byte(&writtenFrame[i]);
+
+	if (sameData) m_pendingSlots &= ~(1 << slot);//CGRAM already holds the same data
+	else m_pendingSlots |= 1 << slot;
+}
+
+template<typename Display>
+void BasicPCF8574LCDAnimator<Display>::writeFrames(const uint8_t& firstSlot, const uint8_t& lastSlot)
+{
+	uint8_t burstData[64];
+	uint8_t burstLength = 0;
+
+	for (uint8_t slot = firstSlot; slot <= lastSlot; slot++)
+	{
+		if (slot != firstSlot)
+		{
+			memset(&burstData[burstLength], 0, getSlotSize() - m_frameSize);//unused rows of 5x10 slot
+			burstLength += getSlotSize() - m_frameSize;
+		}
+
+		const uint8_t* frame = getCurrentFrame(slot);
+		memcpy_P(&burstData[burstLength], frame, m_frameSize);
+		burstLength += m_frameSize;
+		m_animations[slot].writtenFrame = frame;
+	}
+
+	m_display.writeDataToCGRAM(firstSlot * getSlotSize(), burstData, burstLength);
+}
+
+/// <summary>
+/// Animator for PCF8574LCDController.
+/// </summary>
+typedef BasicPCF8574LCDAnimator<PCF8574LCDController> PCF8574LCDAnimator;
+
+/// <summary>
+/// Animator for PCF8574BufferedLCDController.
+/// </summary>
+typedef BasicPCF8574LCDAnimator<PCF8574BufferedLCDController> PCF8574BufferedLCDAnimator;
+
+extern template class BasicPCF8574LCDAnimator<PCF8574LCDController>;
+extern template class BasicPCF8574LCDAnimator<PCF8574BufferedLCDController>;
+
+#endif
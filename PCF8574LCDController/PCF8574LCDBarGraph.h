@@ -0,0 +1,256 @@
+/*
+ Name:		PCF8574LCDBarGraph.h
+ Created:	16/10/2026 08:52:19 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDBarGraph_h
+#define _PCF8574LCDBarGraph_h
+
+#include "PCF8574LCDController.h"
+
+/// <summary>
+/// Orientation of bar graph. Horizontal bar grows right from its first char, vertical bar grows up from its first char.
+/// </summary>
+enum class PCF8574LCDBarGraphOrientation : uint8_t { Horizontal, Vertical };
+
+/// <summary>
+/// Glyphs of partially filled chars of bar graphs, stored in flash.
+/// </summary>
+class PCF8574LCDBarGraphGlyphs final
+{
+public:
+	/// <summary>
+	/// Glyphs with 1 to 4 columns filled from the left, for horizontal bars.
+	/// </summary>
+	static const uint8_t horizontal[4][8];
+
+	/// <summary>
+	/// Glyphs with 1 to 7 rows filled from the bottom, for vertical bars.
+	/// </summary>
+	static const uint8_t vertical[7][8];
+};
+
+/// <summary>
+/// Bar graph with resolution of one pixel column (horizontal) or one pixel row (vertical), drawn on given display type with 5x8 font.
+/// Filled chars use full block char from ROM and partially filled char uses one CGRAM slot, so many bars may be shown at once.
+/// Only chars that changed between values are sent, and only rows of CGRAM slot that changed are uploaded.
+/// </summary>
+template<typename Display>
+class BasicPCF8574LCDBarGraph final
+{
+public:
+	using Orientation = PCF8574LCDBarGraphOrientation;
+
+	/// <summary>
+	/// Char with all pixels set, in A00 ROM of HD44780 and compatible.
+	/// </summary>
+	static const uint8_t fullChar = 0xFF;
+
+	/// <summary>
+	/// Sets value shown by bar and sends changes to display. Values above maximum are shown as maximum.
+	/// </summary>
+	/// <param name="value">Number of filled pixel columns (horizontal) or rows (vertical)</param>
+	void setValue(const uint16_t& value);
+
+	/// <summary>
+	/// Returns value shown by bar.
+	/// </summary>
+	/// <returns>Number of filled pixel columns or rows</returns>
+	uint16_t getValue(void) { return m_value; }
+
+	/// <summary>
+	/// Returns value of fully filled bar.
+	/// </summary>
+	/// <returns>Length of bar in pixel columns or rows</returns>
+	uint16_t getMaxValue(void) { return m_length * getCharResolution(); }
+
+	/// <summary>
+	/// Forgets state of display, so next setValue sends whole bar and its CGRAM slot. Use it after display or CGRAM was changed without bar graph.
+	/// </summary>
+	void invalidate(void) { m_drawn = false; m_glyphLevel = 0; }
+
+	/// <summary>
+	/// Constructor for bar graph. Nothing is sent to display until first setValue.
+	/// </summary>
+	/// <param name="display">Display showing bar</param>
+	/// <param name="x">Char position of first char of bar</param>
+	/// <param name="y">Line of first char of bar</param>
+	/// <param name="length">Number of chars of bar. Vertical bar is limited to lines above first char, horizontal bar to 40 chars</param>
+	/// <param name="orientation">Direction in which bar grows</param>
+	/// <param name="charPosition">CGRAM slot used by partially filled char (from 0 to 7)</param>
+	BasicPCF8574LCDBarGraph(Display& display, const uint8_t& x, const uint8_t& y, const uint8_t& length, const Orientation& orientation, const uint8_t& charPosition) :
+		m_display(display), m_x(x), m_y(y), m_length(orientation == Orientation::Vertical ? (length > y ? y + 1 : length) : (length > 40 ? 40 : length)), m_orientation(orientation), m_charPosition(charPosition & 0x07) {}
+
+	BasicPCF8574LCDBarGraph(const BasicPCF8574LCDBarGraph&) = delete;
+	BasicPCF8574LCDBarGraph& operator=(const BasicPCF8574LCDBarGraph&) = delete;
+
+private:
+	/// <summary>
+	/// Display showing bar.
+	/// </summary>
+	Display& m_display;
+
+	/// <summary>
+	/// Char position of first char of bar.
+	/// </summary>
+	const uint8_t m_x;
+
+	/// <summary>
+	/// Line of first char of bar.
+	/// </summary>
+	const uint8_t m_y;
+
+	/// <summary>
+	/// Number of chars of bar.
+	/// </summary>
+	const uint8_t m_length;
+
+	/// <summary>
+	/// Direction in which bar grows.
+	/// </summary>
+	const Orientation m_orientation;
+
+	/// <summary>
+	/// CGRAM slot used by partially filled char.
+	/// </summary>
+	const uint8_t m_charPosition;
+
+	/// <summary>
+	/// Value shown by bar.
+	/// </summary>
+	uint16_t m_value = 0;
+
+	/// <summary>
+	/// Fill level of glyph in CGRAM slot, 0 if slot wasn't uploaded yet.
+	/// </summary>
+	uint8_t m_glyphLevel = 0;
+
+	/// <summary>
+	/// State of bar on display, false if whole bar must be sent.
+	/// </summary>
+	bool m_drawn = false;
+
+private:
+	/// <summary>
+	/// Returns number of pixel columns or rows in one char.
+	/// </summary>
+	/// <returns>Resolution of char</returns>
+	uint8_t getCharResolution(void) { return m_orientation == Orientation::Horizontal ? 5 : 8; }
+
+	/// <summary>
+	/// Returns char shown on given char of bar for given value.
+	/// </summary>
+	/// <param name="index">Char of bar, 0 = first</param>
+	/// <param name="value">Value of bar</param>
+	/// <returns>Char code</returns>
+	uint8_t getCellChar(const uint8_t& index, const uint16_t& value);
+
+	/// <summary>
+	/// Returns row of glyph of partially filled char with given fill level.
+	/// </summary>
+	/// <param name="level">Number of filled pixel columns or rows (from 1)</param>
+	/// <param name="row">Row of glyph (from 0 to 7)</param>
+	/// <returns>Pixels of row</returns>
+	uint8_t getGlyphRow(const uint8_t& level, const uint8_t& row);
+
+	/// <summary>
+	/// Uploads rows of CGRAM slot that differ between glyph in slot and glyph with given fill level.
+	/// </summary>
+	/// <param name="level">New fill level (from 1)</param>
+	void updateGlyph(const uint8_t& level);
+};
+
+template<typename Display>
+void BasicPCF8574LCDBarGraph<Display>::setValue(const uint16_t& value)
+{
+	uint16_t newValue = value > getMaxValue() ? getMaxValue() : value;
+	if (m_drawn && newValue == m_value) return;
+
+	uint8_t level = newValue % getCharResolution();
+	if (level && level != m_glyphLevel) updateGlyph(level);//glyph is uploaded before it is shown
+
+	uint8_t firstChanged = m_length;
+	uint8_t lastChanged = 0;
+	for (uint8_t i = 0; i < m_length; i++)
+	{
+		if (m_drawn && getCellChar(i, newValue) == getCellChar(i, m_value)) continue;
+
+		if (firstChanged == m_length) firstChanged = i;
+		lastChanged = i;
+
+		if (m_orientation == Orientation::Vertical)//each char of vertical bar is in other line
+		{
+			m_display.setCursorToPosition(m_x, m_y - i);
+			m_display.displayData(static_cast<char>(getCellChar(i, newValue)));
+		}
+	}
+
+	if (m_orientation == Orientation::Horizontal && firstChanged < m_length)//changed chars of horizontal bar are sent as one run
+	{
+		char run[40];
+		uint8_t runLength = 0;
+		for (uint8_t i = firstChanged; i <= lastChanged; i++) run[runLength++] = getCellChar(i, newValue);
+
+		m_display.setCursorToPosition(m_x + firstChanged, m_y);
+		m_display.displayData(run, runLength);
+	}
+
+	m_value = newValue;
+	m_drawn = true;
+	m_display.sendBufferedData();
+}
+
+template<typename Display>
+uint8_t BasicPCF8574LCDBarGraph<Display>::getCellChar(const uint8_t& index, const uint16_t& value)
+{
+	uint8_t filledChars = value / getCharResolution();
+
+	if (index < filledChars) return fullChar;
+	if (index == filledChars && value % getCharResolution()) return m_charPosition;
+	return ' ';
+}
+
+template<typename Display>
+uint8_t BasicPCF8574LCDBarGraph<Display>::getGlyphRow(const uint8_t& level, const uint8_t& row)
+{
+	if (m_orientation == Orientation::Horizontal) return pgm_read_byte(&PCF8574LCDBarGraphGlyphs::horizontal[level - 1][row]);
+	return pgm_read_byte(&PCF8574LCDBarGraphGlyphs::vertical[level - 1][row]);
+}
+
+template<typename Display>
+void BasicPCF8574LCDBarGraph<Display>::updateGlyph(const uint8_t& level)
+{
+	uint8_t rows[8];
+	uint8_t firstChanged = 8;
+	uint8_t lastChanged = 0;
+
+	for (uint8_t i = 0; i < 8; i++)
+	{
+		rows[i] = getGlyphRow(level, i);
+		if (m_glyphLevel && rows[i] == getGlyphRow(m_glyphLevel, i)) continue;
+
+		if (firstChanged == 8) firstChanged = i;
+		lastChanged = i;
+	}
+
+	if (firstChanged < 8) m_display.writeDataToCGRAM((m_charPosition << 3) + firstChanged, &rows[firstChanged], lastChanged - firstChanged + 1);
+	m_glyphLevel = level;
+}
+
+/// <summary>
+/// Bar graph for PCF8574LCDController.
+/// </summary>
+typedef BasicPCF8574LCDBarGraph<PCF8574LCDController> PCF8574LCDBarGraph;
+
+/// <summary>
+/// Bar graph for PCF8574BufferedLCDController.
+/// </summary>
+typedef BasicPCF8574LCDBarGraph<PCF8574BufferedLCDController> PCF8574BufferedLCDBarGraph;
+
+extern template class BasicPCF8574LCDBarGraph<PCF8574LCDController>;
+extern template class BasicPCF8574LCDBarGraph<PCF8574BufferedLCDController>;
+
+#endif
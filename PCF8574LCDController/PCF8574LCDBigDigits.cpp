@@ -0,0 +1,53 @@
+/*
+ Name:		PCF8574LCDBigDigits.cpp
+ Created:	16/10/2026 09:26:40 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDBigDigits.h"
+
+#define BIG_UB 0x00//upper bar
+#define BIG_LB 0x01//lower bar
+#define BIG_MB 0x02//upper and lower bar
+#define BIG_FB 0xFF//full block from ROM
+#define BIG_SP 0x20//space
+
+static const uint8_t bigFontGlyphs[24] PROGMEM = {
+	0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F,
+	0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x1F
+};
+
+static const uint8_t bigFont3x2Digits[60] PROGMEM = {
+	BIG_FB, BIG_UB, BIG_FB,		BIG_FB, BIG_LB, BIG_FB,//0
+	BIG_UB, BIG_FB, BIG_SP,		BIG_LB, BIG_FB, BIG_LB,//1
+	BIG_MB, BIG_MB, BIG_FB,		BIG_FB, BIG_LB, BIG_LB,//2
+	BIG_MB, BIG_MB, BIG_FB,		BIG_LB, BIG_LB, BIG_FB,//3
+	BIG_FB, BIG_LB, BIG_FB,		BIG_SP, BIG_SP, BIG_FB,//4
+	BIG_FB, BIG_MB, BIG_MB,		BIG_LB, BIG_LB, BIG_FB,//5
+	BIG_FB, BIG_MB, BIG_MB,		BIG_FB, BIG_LB, BIG_FB,//6
+	BIG_UB, BIG_UB, BIG_FB,		BIG_SP, BIG_SP, BIG_FB,//7
+	BIG_FB, BIG_MB, BIG_FB,		BIG_FB, BIG_LB, BIG_FB,//8
+	BIG_FB, BIG_MB, BIG_FB,		BIG_LB, BIG_LB, BIG_FB//9
+};
+
+static const uint8_t bigFont3x4Digits[120] PROGMEM = {
+	BIG_FB, BIG_UB, BIG_FB,		BIG_FB, BIG_SP, BIG_FB,		BIG_FB, BIG_SP, BIG_FB,		BIG_FB, BIG_LB, BIG_FB,//0
+	BIG_UB, BIG_FB, BIG_SP,		BIG_SP, BIG_FB, BIG_SP,		BIG_SP, BIG_FB, BIG_SP,		BIG_LB, BIG_FB, BIG_LB,//1
+	BIG_UB, BIG_UB, BIG_FB,		BIG_LB, BIG_LB, BIG_FB,		BIG_FB, BIG_SP, BIG_SP,		BIG_FB, BIG_LB, BIG_LB,//2
+	BIG_UB, BIG_UB, BIG_FB,		BIG_LB, BIG_LB, BIG_FB,		BIG_SP, BIG_SP, BIG_FB,		BIG_LB, BIG_LB, BIG_FB,//3
+	BIG_FB, BIG_SP, BIG_FB,		BIG_FB, BIG_LB, BIG_FB,		BIG_SP, BIG_SP, BIG_FB,		BIG_SP, BIG_SP, BIG_FB,//4
+	BIG_FB, BIG_UB, BIG_UB,		BIG_FB, BIG_LB, BIG_LB,		BIG_SP, BIG_SP, BIG_FB,		BIG_LB, BIG_LB, BIG_FB,//5
+	BIG_FB, BIG_UB, BIG_UB,		BIG_FB, BIG_LB, BIG_LB,		BIG_FB, BIG_SP, BIG_FB,		BIG_FB, BIG_LB, BIG_FB,//6
+	BIG_UB, BIG_UB, BIG_FB,		BIG_SP, BIG_SP, BIG_FB,		BIG_SP, BIG_SP, BIG_FB,		BIG_SP, BIG_SP, BIG_FB,//7
+	BIG_FB, BIG_UB, BIG_FB,		BIG_FB, BIG_LB, BIG_FB,		BIG_FB, BIG_SP, BIG_FB,		BIG_FB, BIG_LB, BIG_FB,//8
+	BIG_FB, BIG_UB, BIG_FB,		BIG_FB, BIG_LB, BIG_FB,		BIG_SP, BIG_SP, BIG_FB,		BIG_LB, BIG_LB, BIG_FB//9
+};
+
+const PCF8574LCDBigFont PCF8574LCDBigFont::font3x2 = { 3, 2, 3, bigFontGlyphs, bigFont3x2Digits };
+const PCF8574LCDBigFont PCF8574LCDBigFont::font3x4 = { 3, 4, 2, bigFontGlyphs, bigFont3x4Digits };
+
+template class BasicPCF8574LCDBigDigits<PCF8574LCDController>;
+template class BasicPCF8574LCDBigDigits<PCF8574BufferedLCDController>;
@@ -0,0 +1,269 @@
+/*
+ Name:		PCF8574LCDBigDigits.h
+ Created:	16/10/2026 09:26:40 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDBigDigits_h
+#define _PCF8574LCDBigDigits_h
+
+#include "PCF8574LCDController.h"
+
+/// <summary>
+/// Font of big digits made of many chars. Glyphs and chars of digits are stored in flash.
+/// Chars of digits are indexes of glyphs (from 0 to 7), or ROM chars (code 0x20 and above), like ' ' and full block 0xFF.
+/// </summary>
+struct PCF8574LCDBigFont
+{
+	/// <summary>
+	/// Number of chars in line of digit.
+	/// </summary>
+	uint8_t width;
+
+	/// <summary>
+	/// Number of lines of digit.
+	/// </summary>
+	uint8_t height;
+
+	/// <summary>
+	/// Number of 5x8 glyphs used by font.
+	/// </summary>
+	uint8_t glyphsCount;
+
+	/// <summary>
+	/// Glyphs used by font, 8 bytes for each glyph, in flash.
+	/// </summary>
+	const uint8_t* glyphs;
+
+	/// <summary>
+	/// Chars of digits from 0 to 9, width x height chars for each digit line by line, in flash.
+	/// </summary>
+	const uint8_t* digits;
+
+	/// <summary>
+	/// Font 3 chars wide and 2 lines high, for 16x2 and larger displays. Uses 3 glyphs.
+	/// </summary>
+	static const PCF8574LCDBigFont font3x2;
+
+	/// <summary>
+	/// Font 3 chars wide and 4 lines high, for 20x4 displays. Uses 2 glyphs.
+	/// </summary>
+	static const PCF8574LCDBigFont font3x4;
+};
+
+/// <summary>
+/// Field of big digits drawn on given display type with 5x8 font. Glyphs of font are uploaded to CGRAM once, before first digit is drawn.
+/// Displayed digits are remembered, so only chars that differ between old and new digit are sent.
+/// </summary>
+template<typename Display>
+class BasicPCF8574LCDBigDigits final
+{
+public:
+	/// <summary>
+	/// Maximum number of digits in field.
+	/// </summary>
+	static const uint8_t maxDigits = 10;
+
+	/// <summary>
+	/// Value of digit drawn as blank field.
+	/// </summary>
+	static const uint8_t blank = 10;
+
+	/// <summary>
+	/// Draws digit on given position of field. Only chars that changed are sent.
+	/// </summary>
+	/// <param name="position">Position in field, 0 = leftmost digit</param>
+	/// <param name="digit">Digit (from 0 to 9) or blank</param>
+	void setDigit(const uint8_t& position, const uint8_t& digit);
+
+	/// <summary>
+	/// Draws number right-aligned in field. Older digits that don't fit are not drawn.
+	/// </summary>
+	/// <param name="value">Number to draw</param>
+	/// <param name="leadingZeros">True = fill field with zeros, false = with blanks</param>
+	void printNumber(unsigned long value, const bool& leadingZeros = false);
+
+	/// <summary>
+	/// Forgets state of display, so glyphs and all digits are sent again. Use it after display or CGRAM was changed without big digits.
+	/// </summary>
+	void invalidate(void) { memset(m_shownDigits, m_unknownDigit, sizeof(m_shownDigits)); m_glyphsLoaded = false; }
+
+	/// <summary>
+	/// Returns number of chars taken by field in line.
+	/// </summary>
+	/// <returns>Width of field</returns>
+	uint8_t getFieldWidth(void) { return m_digitsCount * (m_font.width + m_spacing) - m_spacing; }
+
+	/// <summary>
+	/// Constructor for field of big digits. Nothing is sent to display until first digit is drawn.
+	/// </summary>
+	/// <param name="display">Display showing digits</param>
+	/// <param name="font">Font of digits</param>
+	/// <param name="x">Char position of left edge of field</param>
+	/// <param name="y">Line of top edge of field</param>
+	/// <param name="digitsCount">Number of digits in field (from 1 to maxDigits)</param>
+	/// <param name="charPosition">First CGRAM slot used by glyphs of font. Font uses glyphsCount slots from it</param>
+	/// <param name="spacing">Number of chars between digits, not changed by field</param>
+	BasicPCF8574LCDBigDigits(Display& display, const PCF8574LCDBigFont& font, const uint8_t& x, const uint8_t& y, const uint8_t& digitsCount,
+		const uint8_t& charPosition = 0, const uint8_t& spacing = 1);
+
+	BasicPCF8574LCDBigDigits(const BasicPCF8574LCDBigDigits&) = delete;
+	BasicPCF8574LCDBigDigits& operator=(const BasicPCF8574LCDBigDigits&) = delete;
+
+private:
+	/// <summary>
+	/// Display showing digits.
+	/// </summary>
+	Display& m_display;
+
+	/// <summary>
+	/// Font of digits.
+	/// </summary>
+	const PCF8574LCDBigFont& m_font;
+
+	/// <summary>
+	/// Char position of left edge of field.
+	/// </summary>
+	const uint8_t m_x;
+
+	/// <summary>
+	/// Line of top edge of field.
+	/// </summary>
+	const uint8_t m_y;
+
+	/// <summary>
+	/// Number of digits in field.
+	/// </summary>
+	const uint8_t m_digitsCount;
+
+	/// <summary>
+	/// First CGRAM slot used by glyphs of font.
+	/// </summary>
+	const uint8_t m_charPosition;
+
+	/// <summary>
+	/// Number of chars between digits.
+	/// </summary>
+	const uint8_t m_spacing;
+
+	/// <summary>
+	/// Digit shown on each position of field.
+	/// </summary>
+	uint8_t m_shownDigits[maxDigits];
+
+	/// <summary>
+	/// State of glyphs in CGRAM.
+	/// </summary>
+	bool m_glyphsLoaded = false;
+
+	/// <summary>
+	/// Value of shown digit when state of display is unknown.
+	/// </summary>
+	static const uint8_t m_unknownDigit = 0xFF;
+
+private:
+	/// <summary>
+	/// Returns char shown by given digit on given position of digit.
+	/// </summary>
+	/// <param name="digit">Digit (from 0 to 9) or blank</param>
+	/// <param name="x">Char position in digit</param>
+	/// <param name="y">Line of digit</param>
+	/// <returns>Char code</returns>
+	uint8_t getDigitChar(const uint8_t& digit, const uint8_t& x, const uint8_t& y);
+
+	/// <summary>
+	/// Uploads glyphs of font to CGRAM in one burst.
+	/// </summary>
+	void loadGlyphs(void);
+};
+
+template<typename Display>
+BasicPCF8574LCDBigDigits<Display>::BasicPCF8574LCDBigDigits(Display& display, const PCF8574LCDBigFont& font, const uint8_t& x, const uint8_t& y, const uint8_t& digitsCount,
+	const uint8_t& charPosition, const uint8_t& spacing) :
+	m_display(display), m_font(font), m_x(x), m_y(y), m_digitsCount(digitsCount > maxDigits ? maxDigits : digitsCount), m_charPosition(charPosition & 0x07), m_spacing(spacing)
+{
+	memset(m_shownDigits, m_unknownDigit, sizeof(m_shownDigits));
+}
+
+template<typename Display>
+void BasicPCF8574LCDBigDigits<Display>::setDigit(const uint8_t& position, const uint8_t& digit)
+{
+	if (position >= m_digitsCount || digit > blank || digit == m_shownDigits[position]) return;
+	if (!m_glyphsLoaded) loadGlyphs();
+
+	uint8_t digitX = m_x + position * (m_font.width + m_spacing);
+
+	for (uint8_t y = 0; y < m_font.height; y++)
+	{
+		char line[8];
+		uint8_t firstChanged = m_font.width;
+		uint8_t lastChanged = 0;
+
+		for (uint8_t x = 0; x < m_font.width && x < sizeof(line); x++)
+		{
+			line[x] = getDigitChar(digit, x, y);
+			if (m_shownDigits[position] != m_unknownDigit && static_cast<uint8_t>(line[x]) == getDigitChar(m_shownDigits[position], x, y)) continue;
+
+			if (firstChanged == m_font.width) firstChanged = x;
+			lastChanged = x;
+		}
+
+		if (firstChanged == m_font.width) continue;//line of digit is the same
+
+		m_display.setCursorToPosition(digitX + firstChanged, m_y + y);
+		m_display.displayData(&line[firstChanged], lastChanged - firstChanged + 1);
+	}
+
+	m_shownDigits[position] = digit;
+	m_display.sendBufferedData();
+}
+
+template<typename Display>
+void BasicPCF8574LCDBigDigits<Display>::printNumber(unsigned long value, const bool& leadingZeros)
+{
+	for (uint8_t i = m_digitsCount; i > 0; i--)
+	{
+		bool isBlank = !value && !leadingZeros && i != m_digitsCount;//last digit is always drawn, so 0 is shown
+		setDigit(i - 1, isBlank ? blank : value % 10);
+		value /= 10;
+	}
+}
+
+template<typename Display>
+uint8_t BasicPCF8574LCDBigDigits<Display>::getDigitChar(const uint8_t& digit, const uint8_t& x, const uint8_t& y)
+{
+	if (digit == blank) return ' ';
+
+	uint8_t code = pgm_read_byte(&m_font.digits[(digit * m_font.height + y) * m_font.width + x]);
+	return code < 0x08 ? m_charPosition + code : code;//glyph index is moved to CGRAM slot of font
+}
+
+template<typename Display>
+void BasicPCF8574LCDBigDigits<Display>::loadGlyphs(void)
+{
+	uint8_t glyphs[64];
+	uint8_t length = m_font.glyphsCount << 3;
+	if (length > sizeof(glyphs) - (m_charPosition << 3)) length = sizeof(glyphs) - (m_charPosition << 3);
+
+	for (uint8_t i = 0; i < length; i++) glyphs[i] = pgm_read_byte(&m_font.glyphs[i]);
+
+	m_display.writeDataToCGRAM(m_charPosition << 3, glyphs, length);
+	m_glyphsLoaded = true;
+}
+
+/// <summary>
+/// Big digits for PCF8574LCDController.
+/// </summary>
+typedef BasicPCF8574LCDBigDigits<PCF8574LCDController> PCF8574LCDBigDigits;
+
+/// <summary>
+/// Big digits for PCF8574BufferedLCDController.
+/// </summary>
+typedef BasicPCF8574LCDBigDigits<PCF8574BufferedLCDController> PCF8574BufferedLCDBigDigits;
+
+extern template class BasicPCF8574LCDBigDigits<PCF8574LCDController>;
+extern template class BasicPCF8574LCDBigDigits<PCF8574BufferedLCDController>;
+
+#endif
@@ -0,0 +1,136 @@
+/*
+ Name:		PCF8574LCDBusScheduler.h
+ Created:	16/10/2026 03:10:22 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDBusScheduler_h
+#define _PCF8574LCDBusScheduler_h
+
+#include "PCF8574LCDController.h"
+
+/// <summary>
+/// Scheduler for many displays connected to the same I2C bus. Displays work in asynchronous mode and scheduler sends queued commands
+/// of display that is ready, while other displays are still executing their previous commands, so bus is not idle during long commands like clear display.
+/// </summary>
+template<typename Display, uint8_t MaxDisplays = 8>
+class PCF8574LCDBusScheduler final
+{
+public:
+	/// <summary>
+	/// Adds display to scheduler and enables its asynchronous mode.
+	/// </summary>
+	/// <param name="display">Display connected to bus</param>
+	/// <returns>True if display was added, false if there is no space for it</returns>
+	bool addDisplay(Display& display);
+
+	/// <summary>
+	/// Returns number of displays in scheduler.
+	/// </summary>
+	/// <returns>Number of displays</returns>
+	uint8_t getDisplaysCount(void) { return m_displaysCount; }
+
+	/// <summary>
+	/// Sends at most one I2C transmission to each display that has queued work and finished its previous command. Never waits.
+	/// Displays are served in round robin order, starting after display served first in previous call.
+	/// </summary>
+	/// <returns>True if any display has still work to do</returns>
+	bool tick(void);
+
+	/// <summary>
+	/// Returns time after which next display will be ready for its queued work.
+	/// </summary>
+	/// <returns>Time in microseconds, 0 if some display is ready now or there is no work</returns>
+	uint16_t getTimeToNextWork(void);
+
+	/// <summary>
+	/// Calls tick until all displays are initialized and their queues are empty.
+	/// </summary>
+	void completeQueuedCommands(void) { while (tick()) { asm("nop"); } }
+
+	/// <summary>
+	/// Initializes all displays constructed in asynchronous mode. Warm displays skip reset sequence, and other ones are initialized together,
+	/// so their power on and initialization waits overlap, instead of following one another.
+	/// </summary>
+	/// <param name="allowWarmStart">True to skip reset sequence of displays that kept their state</param>
+	/// <returns>Number of displays that skipped reset sequence</returns>
+	uint8_t begin(const bool& allowWarmStart = true);
+
+private:
+	/// <summary>
+	/// Displays in scheduler.
+	/// </summary>
+	Display* m_displays[MaxDisplays] = {};
+
+	/// <summary>
+	/// Number of displays in scheduler.
+	/// </summary>
+	uint8_t m_displaysCount = 0;
+
+	/// <summary>
+	/// Index of display served first in next tick.
+	/// </summary>
+	uint8_t m_nextDisplay = 0;
+};
+
+template<typename Display, uint8_t MaxDisplays>
+bool PCF8574LCDBusScheduler<Display, MaxDisplays>::addDisplay(Display& display)
+{
+	if (m_displaysCount == MaxDisplays) return false;
+
+	display.setAsynchronousMode(true);
+	m_displays[m_displaysCount++] = &display;
+	return true;
+}
+
+template<typename Display, uint8_t MaxDisplays>
+uint8_t PCF8574LCDBusScheduler<Display, MaxDisplays>::begin(const bool& allowWarmStart)
+{
+	uint8_t warmDisplays = 0;
+
+	for (uint8_t i = 0; i < m_displaysCount && allowWarmStart; i++)
+	{
+		if (m_displays[i]->tryWarmStart()) warmDisplays++;
+	}
+
+	completeQueuedCommands();
+	return warmDisplays;
+}
+
+template<typename Display, uint8_t MaxDisplays>
+bool PCF8574LCDBusScheduler<Display, MaxDisplays>::tick(void)
+{
+	bool workPending = false;
+
+	for (uint8_t i = 0; i < m_displaysCount; i++)
+	{
+		Display& display = *m_displays[(m_nextDisplay + i) % m_displaysCount];
+		if (!display.hasPendingWork()) continue;
+
+		if (!display.getRemainingExecutionTime()) display.tick();//display is ready, so tick sends one transmission
+		if (display.hasPendingWork()) workPending = true;
+	}
+
+	if (m_displaysCount) m_nextDisplay = (m_nextDisplay + 1) % m_displaysCount;
+	return workPending;
+}
+
+template<typename Display, uint8_t MaxDisplays>
+uint16_t PCF8574LCDBusScheduler<Display, MaxDisplays>::getTimeToNextWork(void)
+{
+	uint16_t timeToNextWork = 0xFFFF;
+
+	for (uint8_t i = 0; i < m_displaysCount; i++)
+	{
+		if (!m_displays[i]->hasPendingWork()) continue;
+
+		uint16_t remainingTime = m_displays[i]->getRemainingExecutionTime();
+		if (remainingTime < timeToNextWork) timeToNextWork = remainingTime;
+	}
+
+	return timeToNextWork == 0xFFFF ? 0 : timeToNextWork;
+}
+
+#endif
@@ -15,7 +15,15 @@
 #include "WProgram.h"
 #endif
 
-#include <Wire.h>
+#include "PCF8574LCDTransport.h"
+#include "PCF8574LCDGeometry.h"
+#include "PCF8574LCDPinMap.h"
+#include "PCF8574LCDFormat.h"
+#include "PCF8574LCDStatistics.h"
+
+#ifndef PCF8574_LCD_QUEUE_LENGTH
+#define PCF8574_LCD_QUEUE_LENGTH 32
+#endif
 
 #define PCF8574_DEFAULT_ADDRESS 0x20
 #define PCF8574_ALTERNATE_DEFAULT_ADDRESS 0x27
@@ -33,10 +41,29 @@ uint8_t getEnumValue(const Enumerator& enumType)
 
 #endif // ENUM_CONVERSION
 
-class PCF8574LCDController final
+/// <summary>
+/// Way of waiting for completion of previous command.
+/// BusyFlag = busy flag is read from controller, Timed = only time left from execution time of previous command is waited, without any reads from bus.
+/// </summary>
+enum class PCF8574LCDBusyCheckMode : uint8_t { BusyFlag, Timed };
+
+inline namespace PCF8574_LCD_STATISTICS_NAMESPACE
+{
+
+/// <summary>
+/// PCF8574 LCD Controller using given transport for access to I2C bus, given geometry of display and given pin map of wiring between port expander and LCD.
+/// Derives from Print, so all print functions send chars to display (line endings are not interpreted, so println shouldn't be used).
+/// When PCF8574_LCD_STATISTICS is enabled, work done on I2C bus is counted and returned by getStatistics and getWindowStatistics.
+/// </summary>
+template<typename Transport, typename Geometry = PCF8574RuntimeGeometry, typename PinMap = PCF8574LCDStandardPinMap>
+class BasicPCF8574LCDController final : public Print, private Geometry, private PCF8574LCDStatisticsCounter
 {
 public:
-	enum class LCDDriverType : uint8_t { HD44780, SPLC780D, KS0066 };
+	using LCDDriverType = PCF8574LCDDriverType;
+	using BusyCheckMode = PCF8574LCDBusyCheckMode;
+	using PCF8574LCDStatisticsCounter::getStatistics;
+	using PCF8574LCDStatisticsCounter::getWindowStatistics;
+	using PCF8574LCDStatisticsCounter::resetWindowStatistics;
 
 	/// <summary>
 	/// Clears display.
@@ -118,12 +145,24 @@ public:
 	/// </summary>
 	void shiftDisplayToRight(void) { writeDataI2c(false, setCursorOrDisplayShift(getEnumValue(HD44780CommandsCursorDisplayShift::shiftDisplayRight))); }
 
+	/// <summary>
+	/// Shifts display given number of chars to left. Shift commands are sent in one burst.
+	/// </summary>
+	/// <param name="count">Number of chars</param>
+	void shiftDisplayToLeft(const uint8_t& count) { uint8_t command = setCursorOrDisplayShift(getEnumValue(HD44780CommandsCursorDisplayShift::shiftDisplayLeft)); writeDataBurstI2c(false, &command, count, 0); }
+
+	/// <summary>
+	/// Shifts display given number of chars to right. Shift commands are sent in one burst.
+	/// </summary>
+	/// <param name="count">Number of chars</param>
+	void shiftDisplayToRight(const uint8_t& count) { uint8_t command = setCursorOrDisplayShift(getEnumValue(HD44780CommandsCursorDisplayShift::shiftDisplayRight)); writeDataBurstI2c(false, &command, count, 0); }
+
 	/// <summary>
 	/// Sets cursor to given position.
 	/// </summary>
 	/// <param name="x">Char position</param>
-	/// <param name="y">Line (from 0 to 3)</param>
-	void setCursorToPosition(const uint8_t& x, const uint8_t& y) { if (y > 3) return; writeDataI2c(false, (m_lineOffset[y] + x) | getEnumValue(HD44780CommandsReadWriteData::setDDRAMAddress)); }
+	/// <param name="y">Line (from 0 to number of lines - 1)</param>
+	void setCursorToPosition(const uint8_t& x, const uint8_t& y) { if (y > 3 || y >= Geometry::getSizeY()) return; writeDataI2c(false, (Geometry::getLineOffset(y) + x) | getEnumValue(HD44780CommandsReadWriteData::setDDRAMAddress)); }
 
 	/// <summary>
 	/// Writes one byte of data to DDRAM.
@@ -132,18 +171,67 @@ public:
 	/// <param name="data">Data to write</param>
 	void writeDataToDDRAM(const uint8_t& address, const uint8_t& data) { writeDataI2c(false, address | getEnumValue(HD44780CommandsReadWriteData::setDDRAMAddress)); writeDataI2c(true, data); }
 
+	/// <summary>
+	/// Writes given number of bytes to DDRAM in one burst, starting from given address. Cursor position is restored after that.
+	/// Together with PCF8574LCDSpareMemory it allows using DDRAM not shown on display as storage.
+	/// </summary>
+	/// <param name="address">Starting address in DDRAM</param>
+	/// <param name="data">Data to write</param>
+	/// <param name="length">Number of bytes</param>
+	void writeDataToDDRAM(const uint8_t& address, const uint8_t data[], const uint8_t& length);
+
 	/// <summary>
 	/// Reads one byte from DDRAM.
 	/// </summary>
 	/// <param name="address">Address in DDRAM</param>
 	/// <returns>Readed byte</returns>
-	uint8_t readDataFromDDRAM(const uint8_t& address);
+	uint8_t readDataFromDDRAM(const uint8_t& address) { uint8_t data = 0x00; readDataFromDDRAM(address, &data, 1); return data; }
+
+	/// <summary>
+	/// Reads given number of bytes from DDRAM, starting from given address. Address is set once and bytes are read using auto-increment
+	/// of address counter. Cursor position is restored after that.
+	/// </summary>
+	/// <param name="address">Starting address in DDRAM</param>
+	/// <param name="data">Buffer for readed bytes</param>
+	/// <param name="length">Number of bytes</param>
+	void readDataFromDDRAM(const uint8_t& address, uint8_t data[], const uint8_t& length);
+
+	/// <summary>
+	/// Reads given number of bytes from CGRAM, starting from given address. Address is set once and bytes are read using auto-increment
+	/// of address counter. Cursor position is restored after that.
+	/// </summary>
+	/// <param name="address">Starting address in CGRAM</param>
+	/// <param name="data">Buffer for readed bytes</param>
+	/// <param name="length">Number of bytes</param>
+	void readDataFromCGRAM(const uint8_t& address, uint8_t data[], const uint8_t& length);
 
 	/// <summary>
 	/// Sends data to display.
 	/// </summary>
 	/// <param name="dataToDisplay">String to display</param>
-	void displayData(const char dataToDisplay[]) { while (*dataToDisplay) { writeDataToDDRAM(*dataToDisplay++); } }
+	void displayData(const char dataToDisplay[]);
+
+	/// <summary>
+	/// Sends given number of chars to display. Chars may include custom char 0.
+	/// </summary>
+	/// <param name="dataToDisplay">Chars to display</param>
+	/// <param name="length">Number of chars</param>
+	void displayData(const char dataToDisplay[], const uint8_t& length) { writeDataBurstI2c(true, reinterpret_cast<const uint8_t*>(dataToDisplay), length, 1); }
+
+	/// <summary>
+	/// Sends string stored in program memory to display, for example F("text"). Chars are read from flash while they are transmitted,
+	/// without copy in RAM, so whole string is sent in one burst. Print functions (print(F("text"))) send each char separately.
+	/// </summary>
+	/// <param name="dataToDisplay">String in program memory</param>
+	void displayData(const __FlashStringHelper* dataToDisplay);
+
+	/// <summary>
+	/// Sends given number of chars stored in program memory (PROGMEM) to display, in one burst and without copy in RAM.
+	/// Chars may include custom char 0.
+	/// </summary>
+	/// <param name="dataToDisplay">Chars in program memory</param>
+	/// <param name="length">Number of chars</param>
+	void displayDataFromFlash(const char dataToDisplay[], const uint8_t& length) { writeDataBurstI2c(true, reinterpret_cast<const uint8_t*>(dataToDisplay), length, 1, true); }
 
 	/// <summary>
 	/// Sends data to display.
@@ -151,6 +239,23 @@ public:
 	/// <param name="dataToDisplay">Char to display</param>
 	void displayData(const char& dataToDisplay) { writeDataToDDRAM(dataToDisplay); }
 
+	/// <summary>
+	/// Sends one char to display. Used by print functions.
+	/// </summary>
+	/// <param name="data">Char to display</param>
+	/// <returns>Number of sent chars</returns>
+	size_t write(uint8_t data) { writeDataToDDRAM(data); return 1; }
+
+	/// <summary>
+	/// Sends given number of chars to display in burst mode. Used by print functions, so whole printed text or number is sent at once.
+	/// </summary>
+	/// <param name="buffer">Chars to display</param>
+	/// <param name="size">Number of chars</param>
+	/// <returns>Number of sent chars</returns>
+	size_t write(const uint8_t* buffer, size_t size);
+
+	using Print::write;
+
 	/// <summary>
 	/// Writes given char of size 5x8 to CGRAM. After that, given char may be displayed as other standard chars.
 	/// </summary>
@@ -165,6 +270,15 @@ public:
 	/// <param name="data">New char data array</param>
 	void write5x10CharDataToCGRAM(const uint8_t& charPosition, const uint8_t data[]);
 
+	/// <summary>
+	/// Writes given number of bytes to CGRAM in one burst, starting from given address. Address counter moves to next byte after each one,
+	/// so data of many chars may be written at once. Cursor position is restored after that.
+	/// </summary>
+	/// <param name="address">Starting address in CGRAM</param>
+	/// <param name="data">Data to write</param>
+	/// <param name="length">Number of bytes</param>
+	void writeDataToCGRAM(const uint8_t& address, const uint8_t data[], const uint8_t& length);
+
 	/// <summary>
 	/// Erases line by writing blanks on whole line. After that it will set cursor to beginning of chosen line.
 	/// </summary>
@@ -172,13 +286,13 @@ public:
 	void eraseLine(const uint8_t& lineNumber);
 
 	/// <summary>
-	/// Enables backlight.
+	/// Enables backlight. Port of PCF8574 is not read, its state is taken from software copy.
 	/// </summary>
 	/// <returns>True if changed successfuly</returns>
 	bool enableBacklight(void);
 
 	/// <summary>
-	/// Disables backlight.
+	/// Disables backlight. Port of PCF8574 is not read, its state is taken from software copy.
 	/// </summary>
 	/// <returns>True if changed successfuly</returns>
 	bool disableBacklight(void);
@@ -207,56 +321,289 @@ public:
 	/// <returns>Byte formatted as in controller documentation</returns>
 	uint8_t getCurrentFunctionSet(void) { return m_functionSet; }
 
+	/// <summary>
+	/// Returns address counter of LCD controller. Address counter is tracked in software, so no read from display is made, unless mirror verification is enabled.
+	/// </summary>
+	/// <returns>Current DDRAM or CGRAM address</returns>
+	uint8_t getAddressCounter(void);
+
+	/// <summary>
+	/// Checks if next data write goes to given DDRAM address, using only software copy of address counter.
+	/// </summary>
+	/// <param name="address">DDRAM address</param>
+	/// <returns>True if copy of address counter points at given DDRAM address</returns>
+	bool isAddressCounterAt(const uint8_t& address) { return !m_addressInCGRAM && m_addressCounter == address; }
+
+	/// <summary>
+	/// Enables or disables verification of software copies of address counter and PCF8574 port. When enabled, copies are compared
+	/// with values read from display before they are used and mismatches are counted. Works only in busy flag mode, because it needs reads.
+	/// </summary>
+	/// <param name="enabled">True to enable verification</param>
+	void setMirrorVerification(const bool& enabled) { m_mirrorVerification = enabled; }
+
+	/// <summary>
+	/// Returns state of mirror verification.
+	/// </summary>
+	/// <returns>True if verification is enabled</returns>
+	bool isMirrorVerificationEnabled(void) { return m_mirrorVerification; }
+
+	/// <summary>
+	/// Returns number of mismatches between software copies and values read from display. After mismatch, software copy is replaced by readed value.
+	/// </summary>
+	/// <returns>Number of mismatches</returns>
+	uint16_t getMirrorMismatchCount(void) { return m_mirrorMismatches; }
+
+	/// <summary>
+	/// Returns DDRAM address of first char in given line.
+	/// </summary>
+	/// <param name="line">Line (from 0 to 3)</param>
+	/// <returns>Address in DDRAM</returns>
+	uint8_t getLineAddress(const uint8_t& line) { return Geometry::getLineOffset(line & 0x03); }
+
+	/// <summary>
+	/// Returns number of chars in line.
+	/// </summary>
+	/// <returns>Chars in line</returns>
+	uint8_t getDisplaySizeX(void) { return Geometry::getSizeX(); }
+
+	/// <summary>
+	/// Returns number of lines.
+	/// </summary>
+	/// <returns>Lines count</returns>
+	uint8_t getDisplaySizeY(void) { return Geometry::getSizeY(); }
+
+	/// <summary>
+	/// Sets way of waiting for completion of previous command. Pin maps without R/W line always use Timed mode.
+	/// </summary>
+	/// <param name="newMode">New busy check mode</param>
+	void setBusyCheckMode(const BusyCheckMode& newMode) { m_busyCheckMode = getUsableBusyCheckMode(newMode); }
+
+	/// <summary>
+	/// Disables reading from LCD until end of life of controller, for wiring where reads are not safe, like R/W pin connected also to E line
+	/// of other LCD controller. Busy check mode is always Timed since then, and reads return 0x00.
+	/// </summary>
+	void disableReads(void) { m_readsDisabled = true; m_busyCheckMode = BusyCheckMode::Timed; }
+
+	/// <summary>
+	/// Returns way of waiting for completion of previous command.
+	/// </summary>
+	/// <returns>Current busy check mode</returns>
+	BusyCheckMode getBusyCheckMode(void) { return m_busyCheckMode; }
+
+	/// <summary>
+	/// Sets asynchronous mode. In this mode commands and data are put into queue and sent by tick, based on execution times of previous commands.
+	/// Functions reading from display wait until queue is empty. When asynchronous mode is disabled, queue is emptied first.
+	/// </summary>
+	/// <param name="enabled">True to enable asynchronous mode</param>
+	void setAsynchronousMode(const bool& enabled) { if (!enabled) completeQueuedCommands(); m_asynchronousMode = enabled; }
+
+	/// <summary>
+	/// Returns state of asynchronous mode.
+	/// </summary>
+	/// <returns>True if asynchronous mode is enabled</returns>
+	bool isAsynchronousModeEnabled(void) { return m_asynchronousMode; }
+
+	/// <summary>
+	/// Performs next step of initialization or sends next queued commands or data, if previous command was executed. Never waits and sends at most one I2C transmission.
+	/// </summary>
+	/// <returns>True if there is still work to do</returns>
+	bool tick(void);
+
+	/// <summary>
+	/// Checks if initialization is not finished or queue is not empty.
+	/// </summary>
+	/// <returns>True if there is work for tick</returns>
+	bool hasPendingWork(void) { return m_initializationStep != m_initializationFinished || m_queueLength; }
+
+	/// <summary>
+	/// Returns time left until LCD controller finishes last command or initialization wait, so next command may be sent.
+	/// </summary>
+	/// <returns>Time in microseconds, 0 if ready</returns>
+	uint16_t getRemainingExecutionTime(void) { unsigned long elapsed = micros() - m_lastCommandTime; return elapsed < m_lastCommandDuration ? m_lastCommandDuration - elapsed : 0; }
+
+	/// <summary>
+	/// Calls tick until initialization is finished and queue is empty.
+	/// </summary>
+	void completeQueuedCommands(void) { while (tick()) { asm("nop"); } }
+
+	/// <summary>
+	/// Sends transmissions deferred by transport. Needed only for transports that join transmissions, like PCF8574BufferedWireTransport.
+	/// </summary>
+	void sendBufferedData(void) { Transport::flush(); }
+
+	/// <summary>
+	/// Returns state of initialization.
+	/// </summary>
+	/// <returns>True if display is initialized</returns>
+	bool isInitialized(void) { return m_initializationStep == m_initializationFinished; }
+
+	/// <summary>
+	/// Checks if display kept its state after reset of microcontroller, and if so, finishes initialization without reset sequence and its waits.
+	/// Display is warm when busy flag is readable and cleared, address counter follows set address and it wraps as in number of lines of this display.
+	/// Entry mode, display control and return home are then sent, so display content is kept, but display shift is canceled.
+	/// Works only in busy flag mode, before initialization is finished, so controller must be constructed in asynchronous mode.
+	/// </summary>
+	/// <returns>True if display was warm and is initialized</returns>
+	bool tryWarmStart(void);
+
+	/// <summary>
+	/// Initializes display constructed in asynchronous mode. Reset sequence is skipped if display is warm, otherwise whole initialization
+	/// is performed, with power on wait counted from construction.
+	/// </summary>
+	/// <param name="allowWarmStart">True to skip reset sequence when display kept its state</param>
+	/// <returns>True if reset sequence was skipped</returns>
+	bool begin(const bool& allowWarmStart = true) { bool warmStart = allowWarmStart && tryWarmStart(); completeQueuedCommands(); return warmStart; }
+
+	/// <summary>
+	/// Returns number of commands and data bytes waiting in queue.
+	/// </summary>
+	/// <returns>Number of queued bytes</returns>
+	uint8_t getQueueDepth(void) { return m_queueLength; }
+
+	/// <summary>
+	/// Returns number of commands and data bytes that may be queued without waiting.
+	/// </summary>
+	/// <returns>Free space in queue</returns>
+	uint8_t getQueueFreeSpace(void) { return PCF8574_LCD_QUEUE_LENGTH - m_queueLength; }
+
 	/// <summary>
 	/// Constructor for PCF8574 LCD Controller.
 	/// </summary>
 	/// <param name="pcf8574Address">I2C address of PCF8574</param>
 	/// <param name="sizeX">Chars in line</param>
-	/// <param name="sizeY">Lines count</param>
+	/// <param name="sizeY">Lines count, from 1 to 4, higher values are limited to 4</param>
 	/// <param name="font">Font type selection. 0 = 5x8, 1 = 5x10</param>
-	PCF8574LCDController(
+	/// <param name="driverType">LCD controller type</param>
+	/// <param name="busyCheckMode">Way of waiting for completion of commands. Use Timed mode for modules with R/W line tied low, pin maps without R/W line always use it</param>
+	/// <param name="asynchronousMode">True = constructor returns immediately, initialization and all commands are performed by tick</param>
+	/// <param name="enableLine">Mask of PCF8574 pin connected to E line of LCD controller</param>
+	BasicPCF8574LCDController(
 		const uint8_t& pcf8574Address, const uint8_t& sizeX, const uint8_t& sizeY,
-		const uint8_t& font = 0, LCDDriverType driverType = LCDDriverType::HD44780) :
-		m_pcfAddress(pcf8574Address), m_displaySizeX(sizeX), m_displaySizeY(sizeY),
-		m_displayFont(font)
+		const uint8_t& font = 0, LCDDriverType driverType = LCDDriverType::HD44780,
+		BusyCheckMode busyCheckMode = BusyCheckMode::BusyFlag, const bool& asynchronousMode = false, const uint8_t& enableLine = PinMap::enable) :
+		Geometry(sizeX, sizeY, font, driverType), m_pcfAddress(pcf8574Address), m_enableLine(enableLine), m_busyCheckMode(getUsableBusyCheckMode(busyCheckMode)), m_asynchronousMode(asynchronousMode)
+	{
+		startInitialization();
+	}
+
+	/// <summary>
+	/// Constructor for PCF8574 LCD Controller with geometry given by template parameter, like PCF8574StaticLCDController.
+	/// </summary>
+	/// <param name="pcf8574Address">I2C address of PCF8574</param>
+	/// <param name="busyCheckMode">Way of waiting for completion of commands. Use Timed mode for modules with R/W line tied low, pin maps without R/W line always use it</param>
+	/// <param name="asynchronousMode">True = constructor returns immediately, initialization and all commands are performed by tick</param>
+	/// <param name="enableLine">Mask of PCF8574 pin connected to E line of LCD controller</param>
+	template<typename StaticGeometry = Geometry>//template, so this constructor is instantiated only when used
+	BasicPCF8574LCDController(const uint8_t& pcf8574Address, BusyCheckMode busyCheckMode = BusyCheckMode::BusyFlag, const bool& asynchronousMode = false,
+		const uint8_t& enableLine = PinMap::enable) :
+		Geometry(), m_pcfAddress(pcf8574Address), m_enableLine(enableLine), m_busyCheckMode(getUsableBusyCheckMode(busyCheckMode)), m_asynchronousMode(asynchronousMode)
 	{
-		if (driverType == LCDDriverType::HD44780 || driverType == LCDDriverType::SPLC780D) initializeDisplayHD44780();
-		else initializeDisplayKS0066();
+		startInitialization();
 	}
 
-	PCF8574LCDController(const PCF8574LCDController&) = delete;
-	PCF8574LCDController& operator=(const PCF8574LCDController&) = delete;
+	BasicPCF8574LCDController(const BasicPCF8574LCDController&) = delete;
+	BasicPCF8574LCDController& operator=(const BasicPCF8574LCDController&) = delete;
 
 private:
 	/// <summary>
-	/// Number of chars in line.
+	/// State of backlight.
 	/// </summary>
-	const uint8_t m_displaySizeX;
+	bool m_backlightEnabled = true;
 
 	/// <summary>
-	/// Number of lines.
+	/// I2C address of PCF8574.
 	/// </summary>
-	const uint8_t m_displaySizeY;
+	const uint8_t m_pcfAddress;
 
 	/// <summary>
-	/// Address offset for each display line.
+	/// Mask of PCF8574 pin connected to E line.
 	/// </summary>
-	const uint8_t m_lineOffset[4] = { 0x00, 0x40, m_displaySizeX, 0x40 + m_displaySizeX };
+	const uint8_t m_enableLine;
 
 	/// <summary>
-	/// Display font type.
+	/// True if reading from LCD was disabled by disableReads.
 	/// </summary>
-	const uint8_t m_displayFont;
+	bool m_readsDisabled = false;
 
 	/// <summary>
-	/// State of backlight.
+	/// Way of waiting for completion of previous command.
 	/// </summary>
-	bool m_backlightEnabled = true;
+	BusyCheckMode m_busyCheckMode;
 
 	/// <summary>
-	/// I2C address of PCF8574.
+	/// Time in microseconds when last command or data was sent.
 	/// </summary>
-	const uint8_t m_pcfAddress;
+	unsigned long m_lastCommandTime = 0;
+
+	/// <summary>
+	/// Execution time in microseconds of last command or data.
+	/// </summary>
+	uint16_t m_lastCommandDuration = 0;
+
+	/// <summary>
+	/// Execution times in microseconds for each LCD controller type: clear display or return home, other commands, data write.
+	/// </summary>
+	static const uint16_t m_executionTimes[3][3];
+
+	/// <summary>
+	/// State of asynchronous mode.
+	/// </summary>
+	bool m_asynchronousMode;
+
+	/// <summary>
+	/// Next step of initialization.
+	/// </summary>
+	uint8_t m_initializationStep = 0;
+
+	/// <summary>
+	/// Value of initialization step after finished initialization.
+	/// </summary>
+	static const uint8_t m_initializationFinished = 0xFF;
+
+	/// <summary>
+	/// Queued commands and data bytes.
+	/// </summary>
+	uint8_t m_queueData[PCF8574_LCD_QUEUE_LENGTH];
+
+	/// <summary>
+	/// One bit for each queued byte, set if byte is data and cleared if byte is command.
+	/// </summary>
+	uint8_t m_queueRegisterSelect[(PCF8574_LCD_QUEUE_LENGTH + 7) / 8];
+
+	/// <summary>
+	/// Position of oldest queued byte.
+	/// </summary>
+	uint8_t m_queueHead = 0;
+
+	/// <summary>
+	/// Number of queued bytes.
+	/// </summary>
+	uint8_t m_queueLength = 0;
+
+	/// <summary>
+	/// Software copy of address counter, updated by every command and data sent to display.
+	/// </summary>
+	uint8_t m_addressCounter = 0x00;
+
+	/// <summary>
+	/// True if address counter points to CGRAM, false if it points to DDRAM.
+	/// </summary>
+	bool m_addressInCGRAM = false;
+
+	/// <summary>
+	/// Software copy of last state written to PCF8574 port.
+	/// </summary>
+	uint8_t m_portState = 0x00;
+
+	/// <summary>
+	/// State of verification of software copies.
+	/// </summary>
+	bool m_mirrorVerification = false;
+
+	/// <summary>
+	/// Number of mismatches found by verification of software copies.
+	/// </summary>
+	uint16_t m_mirrorMismatches = 0;
 
 private:
 	/// <summary>
@@ -281,14 +628,52 @@ private:
 
 private:
 	/// <summary>
-	/// Initialization of LCD controller.
+	/// Performs next step of initialization of LCD controller, if wait time of this step passed.
+	/// </summary>
+	/// <returns>True if initialization is finished</returns>
+	bool initializeDisplay(void) { if (Geometry::getDriverType() == LCDDriverType::KS0066) return initializeDisplayKS0066(); return initializeDisplayHD44780(); }
+
+	/// <summary>
+	/// Starts timer of power on wait and, if asynchronous mode is disabled, performs whole initialization.
+	/// </summary>
+	void startInitialization(void);
+
+	/// <summary>
+	/// Performs next step of initialization of LCD controller, if wait time of this step passed.
 	/// </summary>
-	void initializeDisplayHD44780(void);
+	/// <returns>True if initialization is finished</returns>
+	bool initializeDisplayHD44780(void);
 
 	/// <summary>
-	/// Initialization of LCD controller.
+	/// Performs next step of initialization of LCD controller, if wait time of this step passed.
 	/// </summary>
-	void initializeDisplayKS0066(void);
+	/// <returns>True if initialization is finished</returns>
+	bool initializeDisplayKS0066(void);
+
+	/// <summary>
+	/// Extends execution time of last command, so next command is sent after given time.
+	/// </summary>
+	/// <param name="executionTime">Time in microseconds counted from sending of last command</param>
+	void extendExecutionTime(const uint16_t& executionTime) { m_lastCommandDuration = executionTime; }
+
+	/// <summary>
+	/// Sends command during initialization, without using queue.
+	/// </summary>
+	/// <param name="command">Command to send</param>
+	void writeInitializationCommand(const uint8_t& command) { if (!m_asynchronousMode) waitUntilReady(); transmitDataBurstI2c(false, &command, 1, 0); }
+
+	/// <summary>
+	/// Checks state of display kept after reset of microcontroller and sets it as after initialization.
+	/// </summary>
+	/// <returns>True if display is warm</returns>
+	bool checkWarmStart(void);
+
+	/// <summary>
+	/// Sends command during check of warm start, without using queue, and waits for its execution by reading busy flag.
+	/// </summary>
+	/// <param name="command">Command to send</param>
+	/// <returns>True if command was executed in its execution time, false if busy flag stays set</returns>
+	bool writeWarmStartCommand(const uint8_t& command);
 
 	/// <summary>
 	/// Sets how data will be processed by display when entered (shift data, left or right shift).
@@ -325,17 +710,42 @@ private:
 	bool readBusyFlag(void) { return readDataI2c(false) & 0x80; }
 
 	/// <summary>
-	/// Reads current address from address counter.
+	/// Updates software copy of address counter, as LCD controller does after receiving given command or data.
+	/// </summary>
+	/// <param name="rs">Register select. False = instruction register, true = data register</param>
+	/// <param name="data">Sent byte, ignored for data</param>
+	void updateAddressCounter(const bool& rs, const uint8_t& data);
+
+	/// <summary>
+	/// Moves software copy of address counter by one position, wrapping it as LCD controller does.
+	/// </summary>
+	/// <param name="increment">True = increment, false = decrement</param>
+	void moveAddressCounter(const bool& increment);
+
+	/// <summary>
+	/// Writes one byte to PCF8574 port and remembers it in software copy.
+	/// </summary>
+	/// <param name="portState">New state of port</param>
+	void writePortI2c(const uint8_t& portState);
+
+	/// <summary>
+	/// Waits until LCD controller is ready for next command, by reading busy flag or by waiting for end of execution time of last command.
+	/// </summary>
+	void waitUntilReady(void);
+
+	/// <summary>
+	/// Remembers time of sending command or data and its execution time.
 	/// </summary>
-	/// <returns>Address counter value</returns>
-	uint8_t readAddressCounter(void) { return readDataI2c(false) & 0x7F; }
+	/// <param name="rs">Register select. False = instruction register, true = data register</param>
+	/// <param name="data">Sent byte</param>
+	void startExecutionTimer(const bool& rs, const uint8_t& data);
 
 	/// <summary>
 	/// Reads one byte from CGRAM.
 	/// </summary>
 	/// <param name="address">Address in CGRAM</param>
 	/// <returns>Readed byte</returns>
-	uint8_t readDataFromCGRAM(const uint8_t& address);
+	uint8_t readDataFromCGRAM(const uint8_t& address) { uint8_t data = 0x00; readDataFromCGRAM(address, &data, 1); return data; }
 
 	/// <summary>
 	/// Writes one byte of data to CGRAM.
@@ -365,12 +775,64 @@ private:
 	/// <param name="data">Byte to write. Only upper half will be used</param>
 	void writeNibbleDataI2c(const bool& rs, const uint8_t& data);
 
+	/// <summary>
+	/// Returns busy check mode possible with wiring of this controller. Busy flag can't be read when pin map has no R/W line or reads are disabled.
+	/// </summary>
+	/// <param name="mode">Requested busy check mode</param>
+	/// <returns>Requested mode, or Timed mode for pin maps without R/W line and after disableReads</returns>
+	BusyCheckMode getUsableBusyCheckMode(const BusyCheckMode& mode) { return PinMap::readWrite && !m_readsDisabled ? mode : BusyCheckMode::Timed; }
+
 	/// <summary>
 	/// Reads one byte from LCD at current address counter.
 	/// </summary>
 	/// <param name="rs">Register select. False = instruction register, true = data register</param>
 	/// <returns>Readed byte</returns>
-	uint8_t readDataI2c(const bool& rs);
+	uint8_t readDataI2c(const bool& rs) { uint8_t data = 0x00; readDataBurstI2c(rs, &data, 1); return data; }
+
+	/// <summary>
+	/// Reads many bytes from LCD starting at current address counter. E line falling edge ending each nibble is sent together with rising edge of next one.
+	/// </summary>
+	/// <param name="rs">Register select. False = instruction register, true = data register</param>
+	/// <param name="data">Buffer for readed bytes. Bytes that couldn't be read are set to 0</param>
+	/// <param name="length">Number of bytes</param>
+	void readDataBurstI2c(const bool& rs, uint8_t data[], const uint8_t& length);
+
+	/// <summary>
+	/// Writes many bytes to LCD at current address counter, packing E line strobes of consecutive bytes into as few I2C transmissions as I2C buffer allows.
+	/// Controller readiness is checked only once, because at 100 kHz (max for PCF8574) sending one byte over I2C takes longer than execution of data write or ordinary command.
+	/// Must not be used for clearing display or returning home.
+	/// </summary>
+	/// <param name="rs">Register select. False = instruction register, true = data register</param>
+	/// <param name="data">Bytes to write</param>
+	/// <param name="length">Number of bytes to write</param>
+	/// <param name="dataStep">Step between written bytes. 1 = write consecutive bytes, 0 = repeat first byte</param>
+	/// <param name="fromFlash">True if bytes are stored in program memory</param>
+	void writeDataBurstI2c(const bool& rs, const uint8_t data[], const uint8_t& length, const uint8_t& dataStep, const bool& fromFlash = false);
+
+	/// <summary>
+	/// Sends many bytes to LCD in burst, without checking if LCD controller is ready and without using queue.
+	/// </summary>
+	/// <param name="rs">Register select. False = instruction register, true = data register</param>
+	/// <param name="data">Bytes to write</param>
+	/// <param name="length">Number of bytes to write</param>
+	/// <param name="dataStep">Step between written bytes. 1 = write consecutive bytes, 0 = repeat first byte</param>
+	/// <param name="fromFlash">True if bytes are stored in program memory</param>
+	void transmitDataBurstI2c(const bool& rs, const uint8_t data[], const uint8_t& length, const uint8_t& dataStep, const bool& fromFlash = false);
+
+	/// <summary>
+	/// Reads byte of burst from RAM or program memory.
+	/// </summary>
+	/// <param name="data">Address of byte</param>
+	/// <param name="fromFlash">True if byte is stored in program memory</param>
+	/// <returns>Readed byte</returns>
+	static uint8_t readBurstByte(const uint8_t* data, const bool& fromFlash) { return fromFlash ? pgm_read_byte(data) : *data; }
+
+	/// <summary>
+	/// Puts one byte into queue. If queue is full, waits until there is space for it.
+	/// </summary>
+	/// <param name="rs">Register select. False = instruction register, true = data register</param>
+	/// <param name="data">Byte to queue</param>
+	void queueDataI2c(const bool& rs, const uint8_t& data);
 
 private:
 	enum class HD44780CommandsBase : uint8_t {
@@ -416,4 +878,619 @@ private:
 	};
 };
 
+template<typename Transport, typename Geometry, typename PinMap>
+const uint16_t BasicPCF8574LCDController<Transport, Geometry, PinMap>::m_executionTimes[3][3] = {
+	{ 2160, 53, 59 },//HD44780: 1,52ms, 37us and 37us + 4us at 270kHz, scaled for slowest 190kHz oscillator
+	{ 2160, 53, 59 },//SPLC780D: same timings as HD44780
+	{ 2175, 56, 62 }//KS0066: 1,53ms, 39us and 43us at 270kHz, scaled for slowest 190kHz oscillator
+};
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::displayData(const char dataToDisplay[])
+{
+	write(reinterpret_cast<const uint8_t*>(dataToDisplay), strlen(dataToDisplay));
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::displayData(const __FlashStringHelper* dataToDisplay)
+{
+	const uint8_t* data = reinterpret_cast<const uint8_t*>(dataToDisplay);
+	size_t size = strlen_P(reinterpret_cast<PGM_P>(dataToDisplay));
+
+	while (size)
+	{
+		uint8_t chunkLength = size > 0xFF ? 0xFF : static_cast<uint8_t>(size);
+		writeDataBurstI2c(true, data, chunkLength, 1, true);
+		data += chunkLength;
+		size -= chunkLength;
+	}
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+size_t BasicPCF8574LCDController<Transport, Geometry, PinMap>::write(const uint8_t* buffer, size_t size)
+{
+	const size_t sentChars = size;
+
+	while (size)
+	{
+		uint8_t chunkLength = size > 0xFF ? 0xFF : static_cast<uint8_t>(size);
+		writeDataBurstI2c(true, buffer, chunkLength, 1);
+		buffer += chunkLength;
+		size -= chunkLength;
+	}
+
+	return sentChars;
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::writeDataToDDRAM(const uint8_t& address, const uint8_t data[], const uint8_t& length)
+{
+	uint8_t DDRAMaddr = getAddressCounter();//save cursor position
+
+	writeDataI2c(false, (address & 0x7F) | getEnumValue(HD44780CommandsReadWriteData::setDDRAMAddress));//set starting DDRAM address
+	writeDataBurstI2c(true, data, length, 1);
+
+	writeDataI2c(false, DDRAMaddr | getEnumValue(HD44780CommandsReadWriteData::setDDRAMAddress));//restore cursor position
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::readDataFromDDRAM(const uint8_t& address, uint8_t data[], const uint8_t& length)
+{
+	uint8_t DDRAMaddr = getAddressCounter();//save cursor position
+
+	writeDataI2c(false, (address & 0x7F) | getEnumValue(HD44780CommandsReadWriteData::setDDRAMAddress));//set starting DDRAM address
+	readDataBurstI2c(true, data, length);
+
+	writeDataI2c(false, DDRAMaddr | getEnumValue(HD44780CommandsReadWriteData::setDDRAMAddress));//restore cursor position
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::write5x8CharDataToCGRAM(const uint8_t& charPosition, const uint8_t data[])
+{
+	writeDataToCGRAM((charPosition & 0x07) << 3, data, 8);
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::write5x10CharDataToCGRAM(const uint8_t& charPosition, const uint8_t data[])
+{
+	writeDataToCGRAM((charPosition & 0x06) << 3, data, 11);
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::writeDataToCGRAM(const uint8_t& address, const uint8_t data[], const uint8_t& length)
+{
+	uint8_t DDRAMaddr = getAddressCounter();//save cursor position
+
+	writeDataI2c(false, (address & 0x3F) | getEnumValue(HD44780CommandsReadWriteData::setCGRAMAddress));//set starting CGRAM address
+	writeDataBurstI2c(true, data, length, 1);
+
+	writeDataI2c(false, DDRAMaddr | getEnumValue(HD44780CommandsReadWriteData::setDDRAMAddress));//restore cursor position
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::eraseLine(const uint8_t& lineNumber)
+{
+	const uint8_t blank = ' ';
+
+	setCursorToPosition(static_cast<uint8_t>(0), lineNumber);
+	writeDataBurstI2c(true, &blank, Geometry::getSizeX(), 0);
+	setCursorToPosition(static_cast<uint8_t>(0), lineNumber);
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+bool BasicPCF8574LCDController<Transport, Geometry, PinMap>::enableBacklight(void)
+{
+	writePortI2c(m_portState | PinMap::backlight);
+
+	m_backlightEnabled = true;
+	return true;
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+bool BasicPCF8574LCDController<Transport, Geometry, PinMap>::disableBacklight(void)
+{
+	writePortI2c(m_portState & ~PinMap::backlight);
+
+	m_backlightEnabled = false;
+	return true;
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+uint8_t BasicPCF8574LCDController<Transport, Geometry, PinMap>::getAddressCounter(void)
+{
+	if (m_mirrorVerification && m_busyCheckMode == BusyCheckMode::BusyFlag)
+	{
+		if (m_asynchronousMode) completeQueuedCommands();
+		waitUntilReady();//address counter is valid only after execution of last command
+
+		uint8_t address = readDataI2c(false) & 0x7F;
+		if (address != m_addressCounter)
+		{
+			m_mirrorMismatches++;
+			m_addressCounter = address;
+		}
+	}
+
+	return m_addressCounter;
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::updateAddressCounter(const bool& registerSelect, const uint8_t& data)
+{
+	if (registerSelect)//data write or read
+	{
+		moveAddressCounter(m_entryMode & 0x02);
+		return;
+	}
+
+	if (data & 0x80)//set DDRAM address
+	{
+		m_addressCounter = data & 0x7F;
+		m_addressInCGRAM = false;
+	}
+	else if (data & 0x40)//set CGRAM address
+	{
+		m_addressCounter = data & 0x3F;
+		m_addressInCGRAM = true;
+	}
+	else if (data & 0x20) return;//function set
+	else if (data & 0x10)//cursor or display shift, display shift doesn't change address
+	{
+		if (!(data & 0x08)) moveAddressCounter(data & 0x04);
+	}
+	else if (data & 0x0C) return;//display control or entry mode
+	else if (data)//clear display or return home
+	{
+		m_addressCounter = 0x00;
+		m_addressInCGRAM = false;
+		if (data & 0x01) m_entryMode |= 0x02;//clear display also sets increment mode
+	}
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::moveAddressCounter(const bool& increment)
+{
+	if (m_addressInCGRAM)
+	{
+		m_addressCounter = (m_addressCounter + (increment ? 1 : -1)) & 0x3F;
+		return;
+	}
+
+	if (Geometry::getFunctionSet() & 0x08)//two lines: 0x00-0x27 and 0x40-0x67, end of one line wraps to other one
+	{
+		if (increment) m_addressCounter = (m_addressCounter & 0x3F) == 0x27 ? (m_addressCounter ^ 0x40) & 0x40 : m_addressCounter + 1;
+		else m_addressCounter = (m_addressCounter & 0x3F) == 0x00 ? (m_addressCounter ^ 0x40) | 0x27 : m_addressCounter - 1;
+	}
+	else//one line: 0x00-0x4F
+	{
+		if (increment) m_addressCounter = m_addressCounter == 0x4F ? 0x00 : m_addressCounter + 1;
+		else m_addressCounter = m_addressCounter == 0x00 ? 0x4F : m_addressCounter - 1;
+	}
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::writePortI2c(const uint8_t& portState)
+{
+	if (m_mirrorVerification && m_busyCheckMode == BusyCheckMode::BusyFlag)
+	{
+		uint8_t readedState = 0;
+		bool readSucceeded = Transport::read(m_pcfAddress, readedState);
+		countRead(readSucceeded);
+		if (readSucceeded && readedState != m_portState)
+		{
+			m_mirrorMismatches++;
+			m_portState = readedState;
+		}
+	}
+
+	Transport::beginTransmission(m_pcfAddress);
+	Transport::write(portState);
+	Transport::endTransmission();
+	countTransmission(1);
+	m_portState = portState;
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::startInitialization(void)
+{
+	m_lastCommandTime = micros();
+	m_lastCommandDuration = Geometry::getDriverType() == LCDDriverType::KS0066 ? 40000 : 60000;//wait > 30ms after VDD > 4,5V (KS0066), > 40ms after VDD > 2,7V (HD44780)
+	if (!m_asynchronousMode) { while (!initializeDisplay()) { asm("nop"); } Transport::flush(); }
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+bool BasicPCF8574LCDController<Transport, Geometry, PinMap>::initializeDisplayHD44780(void)
+{
+	if (micros() - m_lastCommandTime < m_lastCommandDuration) return false;//wait for power on or previous step
+
+	switch (m_initializationStep)
+	{
+	case 0:
+		writeNibbleDataI2c(false, setFunctionSet(getEnumValue(HD44780CommandsFunctionSet::set8bitInterface)));//send nibble with interface setted to 8bit
+		extendExecutionTime(6000);//wait > 4,1ms
+		break;
+	case 1:
+		writeNibbleDataI2c(false, m_functionSet);//send last setting again
+		extendExecutionTime(2000);//wait > 100us
+		break;
+	case 2:
+		writeNibbleDataI2c(false, m_functionSet);//send last setting again
+		break;
+	case 3:
+		writeNibbleDataI2c(false, setFunctionSet(getEnumValue(HD44780CommandsFunctionSet::set4bitInterface)));//set interface to 4bit
+
+		m_functionSet = Geometry::getFunctionSet();//choose number of lines and font
+		break;
+	case 4:
+		writeInitializationCommand(m_functionSet);//set number of lines and font
+		break;
+	case 5:
+		writeInitializationCommand(0x08);//disable cursor, cursor blinking, and display
+		break;
+	case 6:
+		writeInitializationCommand(getEnumValue(HD44780CommandsBase::clearDisplay));
+		break;
+	case 7:
+		writeInitializationCommand(m_entryMode);//set cursor moving right and no display shift
+		break;
+	default:
+		writeInitializationCommand(setDisplayControl(getEnumValue(HD44780CommandsDisplayControl::setDisplayOn)));
+		m_initializationStep = m_initializationFinished;
+		return true;
+	}
+
+	m_initializationStep++;
+	return false;
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+bool BasicPCF8574LCDController<Transport, Geometry, PinMap>::initializeDisplayKS0066(void)
+{
+	if (micros() - m_lastCommandTime < m_lastCommandDuration) return false;//wait for power on or previous step
+
+	switch (m_initializationStep)
+	{
+	case 0:
+		writeNibbleDataI2c(false, m_functionSet);//send nibble with interface setted to 4bit
+
+		m_functionSet = Geometry::getFunctionSet();//choose number of lines and font
+		break;
+	case 1:
+		writeInitializationCommand(m_functionSet);//set number of lines and font
+		extendExecutionTime(2000);//wait > 39us
+		break;
+	case 2:
+		writeInitializationCommand(0x08);//disable cursor, cursor blinking, and display
+		extendExecutionTime(2000);//wait > 39us
+		break;
+	case 3:
+		writeInitializationCommand(getEnumValue(HD44780CommandsBase::clearDisplay));
+		extendExecutionTime(3000);//wait > 1,5ms
+		break;
+	case 4:
+		writeInitializationCommand(m_entryMode);//set cursor moving right and no display shift
+		break;
+	default:
+		writeInitializationCommand(setDisplayControl(getEnumValue(HD44780CommandsDisplayControl::setDisplayOn)));
+		m_initializationStep = m_initializationFinished;
+		return true;
+	}
+
+	m_initializationStep++;
+	return false;
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+bool BasicPCF8574LCDController<Transport, Geometry, PinMap>::tryWarmStart(void)
+{
+	if (isInitialized() || m_busyCheckMode != BusyCheckMode::BusyFlag) return false;
+
+	const unsigned long powerOnTime = m_lastCommandTime;
+	const uint16_t powerOnDuration = m_lastCommandDuration;
+	const bool asynchronousMode = m_asynchronousMode;
+	const uint8_t addressCounter = m_addressCounter;//mirror already includes moves of queued commands
+	const bool addressInCGRAM = m_addressInCGRAM;
+
+	m_asynchronousMode = false;//commands of check are sent directly, before queued ones
+	bool warmStart = checkWarmStart();
+	m_asynchronousMode = asynchronousMode;
+	m_addressCounter = addressCounter;//check ends at home position, from which queued commands reach mirrored address
+	m_addressInCGRAM = addressInCGRAM;
+
+	if (!warmStart)//initialization waits for power on as if check wasn't made
+	{
+		m_lastCommandTime = powerOnTime;
+		m_lastCommandDuration = powerOnDuration;
+	}
+
+	return warmStart;
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+bool BasicPCF8574LCDController<Transport, Geometry, PinMap>::checkWarmStart(void)
+{
+	const uint8_t lastAddress = Geometry::getFunctionSet() & 0x08 ? 0x27 : 0x4F;//last DDRAM address in number of lines of this display
+	const uint8_t wrappedAddress = Geometry::getFunctionSet() & 0x08 ? 0x40 : 0x00;//address after it
+
+	if (readBusyFlag()) return false;//controller after power on is busy with internal reset
+	if (!writeWarmStartCommand(m_entryMode)) return false;//address counter must be incremented by read below
+	if (!writeWarmStartCommand(lastAddress | getEnumValue(HD44780CommandsReadWriteData::setDDRAMAddress))) return false;
+	if ((readDataI2c(false) & 0x7F) != lastAddress) return false;//4bit interface isn't synchronized or is in 8bit mode
+
+	readDataI2c(true);//read of data moves address counter
+	if ((readDataI2c(false) & 0x7F) != wrappedAddress) return false;//number of lines differs from this display
+
+	if (!writeWarmStartCommand(m_displayControl)) return false;
+	if (!writeWarmStartCommand(getEnumValue(HD44780CommandsBase::returnHome))) return false;//cancels display shift
+
+	m_functionSet = Geometry::getFunctionSet();
+	m_initializationStep = m_initializationFinished;
+	return true;
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+bool BasicPCF8574LCDController<Transport, Geometry, PinMap>::writeWarmStartCommand(const uint8_t& command)
+{
+	transmitDataBurstI2c(false, &command, 1, 0);
+	Transport::flush();
+
+	while (readBusyFlag())
+	{
+		if (micros() - m_lastCommandTime > m_lastCommandDuration * 2UL) return false;//controller that doesn't understand commands may stay busy
+	}
+
+	return true;
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+bool BasicPCF8574LCDController<Transport, Geometry, PinMap>::tick(void)
+{
+	if (!hasPendingWork()) return false;
+	if (micros() - m_lastCommandTime < m_lastCommandDuration) return true;//previous command or initialization wait is still executed
+
+	if (m_initializationStep != m_initializationFinished)
+	{
+		initializeDisplay();
+		return true;
+	}
+
+	uint8_t burstData[(Transport::bufferLength - 1) / 4];//bytes that fit into one transmission
+	uint8_t burstLength = 0;
+	const bool registerSelect = m_queueRegisterSelect[m_queueHead >> 3] & (1 << (m_queueHead & 0x07));
+
+	while (m_queueLength && burstLength < sizeof(burstData))
+	{
+		if (static_cast<bool>(m_queueRegisterSelect[m_queueHead >> 3] & (1 << (m_queueHead & 0x07))) != registerSelect) break;
+
+		burstData[burstLength++] = m_queueData[m_queueHead];
+		m_queueHead = (m_queueHead + 1) % PCF8574_LCD_QUEUE_LENGTH;
+		m_queueLength--;
+
+		if (!registerSelect && burstData[burstLength - 1] < 0x04) break;//clear display and return home need wait before next byte
+	}
+
+	transmitDataBurstI2c(registerSelect, burstData, burstLength, 1);
+	Transport::flush();
+	return true;
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::readDataFromCGRAM(const uint8_t& address, uint8_t data[], const uint8_t& length)
+{
+	uint8_t DDRAMaddr = getAddressCounter();//save cursor position
+
+	writeDataI2c(false, (address & 0x3F) | getEnumValue(HD44780CommandsReadWriteData::setCGRAMAddress));//set address of CGRAM to read
+	readDataBurstI2c(true, data, length);//read data from CGRAM
+
+	writeDataI2c(false, DDRAMaddr | getEnumValue(HD44780CommandsReadWriteData::setDDRAMAddress));//restore cursor position
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::writeDataToCGRAM(const uint8_t& address, const uint8_t& data)
+{
+	uint8_t DDRAMaddr = getAddressCounter();//save cursor position
+
+	writeDataI2c(false, address | getEnumValue(HD44780CommandsReadWriteData::setCGRAMAddress));//set CGRAM position
+	writeDataI2c(true, data);//write data to given position
+
+	writeDataI2c(false, DDRAMaddr | getEnumValue(HD44780CommandsReadWriteData::setDDRAMAddress));//restore cursor position
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::writeDataI2c(const bool& registerSelect, const uint8_t& dataToWrite)
+{
+	writeDataBurstI2c(registerSelect, &dataToWrite, 1, 0);
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::writeDataBurstI2c(const bool& registerSelect, const uint8_t data[], const uint8_t& length, const uint8_t& dataStep, const bool& fromFlash)
+{
+	if (!length) return;
+
+	for (uint8_t i = 0; i < length; i++) updateAddressCounter(registerSelect, readBurstByte(&data[i * dataStep], fromFlash));
+
+	if (m_asynchronousMode)
+	{
+		for (uint8_t i = 0; i < length; i++, data += dataStep) queueDataI2c(registerSelect, readBurstByte(data, fromFlash));
+		return;
+	}
+
+	waitUntilReady();
+	transmitDataBurstI2c(registerSelect, data, length, dataStep, fromFlash);
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::transmitDataBurstI2c(const bool& registerSelect, const uint8_t data[], const uint8_t& length, const uint8_t& dataStep, const bool& fromFlash)
+{
+	uint8_t writeParams = 0;
+	if (registerSelect) writeParams |= PinMap::registerSelect;
+	if (m_backlightEnabled) writeParams |= PinMap::backlight;
+
+	const uint8_t lastData = readBurstByte(&data[(length - 1) * dataStep], fromFlash);
+
+	Transport::beginTransmission(m_pcfAddress);
+	Transport::write(PinMap::getUpperNibble(readBurstByte(data, fromFlash)) | writeParams);//set register select before first rising edge of E line
+	uint8_t bytesInTransmission = 1;
+
+	for (uint8_t i = 0; i < length; i++, data += dataStep)
+	{
+		if (bytesInTransmission > Transport::bufferLength - 4)//each byte needs four port states
+		{
+			Transport::endTransmission();
+			countTransmission(bytesInTransmission);
+			Transport::beginTransmission(m_pcfAddress);
+			bytesInTransmission = 0;
+		}
+
+		const uint8_t dataByte = readBurstByte(data, fromFlash);
+		const uint8_t upperNibble = PinMap::getUpperNibble(dataByte);
+		const uint8_t lowerNibble = PinMap::getLowerNibble(dataByte);
+		Transport::write(upperNibble | writeParams | m_enableLine);//upper nibble, E high
+		Transport::write(upperNibble | writeParams);//E low, upper nibble latched
+		Transport::write(lowerNibble | writeParams | m_enableLine);//lower nibble, E high
+		Transport::write(lowerNibble | writeParams);//E low, lower nibble latched
+		bytesInTransmission += 4;
+	}
+
+	Transport::endTransmission();
+	countTransmission(bytesInTransmission);
+	m_portState = PinMap::getLowerNibble(lastData) | writeParams;
+	if (!registerSelect && lastData < 0x04) Transport::flush();//execution time of clear display and return home is counted from now, so they can't be deferred
+	startExecutionTimer(registerSelect, lastData);
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::writeNibbleDataI2c(const bool& registerSelect, const uint8_t& data)
+{
+	uint8_t writeParams = 0;
+	if (registerSelect) writeParams |= PinMap::registerSelect;
+	if (m_backlightEnabled) writeParams |= PinMap::backlight;
+
+	Transport::beginTransmission(m_pcfAddress);
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		Transport::write(PinMap::getUpperNibble(data) | writeParams);
+
+		writeParams ^= m_enableLine;//change state of E line
+	}
+	Transport::endTransmission();
+	countTransmission(3);
+	Transport::flush();//waits of initialization are counted from now, so nibbles can't be deferred
+	m_portState = PinMap::getUpperNibble(data) | (writeParams & ~m_enableLine);//E line is low after last write
+	startExecutionTimer(registerSelect, data);
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::queueDataI2c(const bool& registerSelect, const uint8_t& data)
+{
+	if (m_queueLength == PCF8574_LCD_QUEUE_LENGTH)
+	{
+		unsigned long blockingStartTime = getBlockingStartTime();
+		while (m_queueLength == PCF8574_LCD_QUEUE_LENGTH) tick();
+		countBlockedTime(blockingStartTime);
+	}
+
+	uint8_t position = (m_queueHead + m_queueLength) % PCF8574_LCD_QUEUE_LENGTH;
+	m_queueData[position] = data;
+	if (registerSelect) m_queueRegisterSelect[position >> 3] |= 1 << (position & 0x07);
+	else m_queueRegisterSelect[position >> 3] &= ~(1 << (position & 0x07));
+	m_queueLength++;
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::waitUntilReady(void)
+{
+	unsigned long blockingStartTime = getBlockingStartTime();
+
+	if (m_busyCheckMode == BusyCheckMode::BusyFlag)
+	{
+		do { countBusyFlagPoll(); } while (readBusyFlag());
+	}
+	else
+	{
+		while (micros() - m_lastCommandTime < m_lastCommandDuration) { asm("nop"); }
+	}
+
+	countBlockedTime(blockingStartTime);
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::startExecutionTimer(const bool& registerSelect, const uint8_t& data)
+{
+	uint8_t timeType = 2;//data write
+	if (!registerSelect) timeType = data < 0x04 ? 0 : 1;//clear display and return home are much longer than other commands
+
+	m_lastCommandDuration = m_executionTimes[getEnumValue(Geometry::getDriverType())][timeType];
+	m_lastCommandTime = micros();
+}
+
+template<typename Transport, typename Geometry, typename PinMap>
+void BasicPCF8574LCDController<Transport, Geometry, PinMap>::readDataBurstI2c(const bool& registerSelect, uint8_t data[], const uint8_t& length)
+{
+	uint8_t readParams = PinMap::dataLines | PinMap::readWrite;//set high state for data lines as weak pullup
+	bool readFailed = false;
+
+	if (!length) return;
+	if (!PinMap::readWrite || m_readsDisabled)//without R/W line strobe of E would write to controller
+	{
+		for (uint8_t i = 0; i < length; i++) data[i] = 0x00;
+		return;
+	}
+	if (m_asynchronousMode) completeQueuedCommands();//queued commands must be executed before reading
+
+	if (registerSelect) readParams |= PinMap::registerSelect;
+	if (m_backlightEnabled) readParams |= PinMap::backlight;
+
+	for (uint16_t i = 0; i < length * 2; i++)//two nibbles for each byte
+	{
+		Transport::beginTransmission(m_pcfAddress);
+		Transport::write(readParams);//E low, previous nibble is finished
+		Transport::write(readParams | m_enableLine);//E high, nibble is placed on data lines
+		Transport::endTransmission();
+		countTransmission(2);
+
+		uint8_t portState = 0;
+		bool readSucceeded = Transport::read(m_pcfAddress, portState);
+		countRead(readSucceeded);
+		if (!readSucceeded) readFailed = true;
+
+		if (!(i & 0x01))
+		{
+			data[i >> 1] = PinMap::getNibble(portState) << 4;
+			continue;
+		}
+
+		data[i >> 1] = readFailed ? 0x00 : data[i >> 1] | PinMap::getNibble(portState);
+		readFailed = false;
+		if (registerSelect) updateAddressCounter(true, data[i >> 1]);//reading data moves address counter as writing
+	}
+
+	Transport::beginTransmission(m_pcfAddress);
+	Transport::write(readParams);//E low
+	Transport::endTransmission();
+	countTransmission(1);
+	m_portState = readParams;
+}
+
+} // namespace PCF8574_LCD_STATISTICS_NAMESPACE
+
+/// <summary>
+/// PCF8574 LCD Controller sending each transmission immediately through Wire.
+/// </summary>
+typedef BasicPCF8574LCDController<PCF8574WireTransport<Wire>> PCF8574LCDController;
+
+/// <summary>
+/// PCF8574 LCD Controller joining transmissions through Wire until sendBufferedData is called. Best used with timed busy check mode.
+/// </summary>
+typedef BasicPCF8574LCDController<PCF8574BufferedWireTransport<Wire>> PCF8574BufferedLCDController;
+
+/// <summary>
+/// PCF8574 LCD Controller with geometry and LCD controller type given at compile time, sending transmissions through given transport.
+/// </summary>
+template<uint8_t SizeX, uint8_t SizeY, uint8_t Font = 0, PCF8574LCDDriverType DriverType = PCF8574LCDDriverType::HD44780, typename Transport = PCF8574WireTransport<Wire>>
+using PCF8574StaticLCDController = BasicPCF8574LCDController<Transport, PCF8574StaticGeometry<SizeX, SizeY, Font, DriverType>>;
+
+extern template class BasicPCF8574LCDController<PCF8574WireTransport<Wire>>;
+extern template class BasicPCF8574LCDController<PCF8574BufferedWireTransport<Wire>>;
+
 #endif
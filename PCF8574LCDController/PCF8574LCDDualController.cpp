@@ -0,0 +1,12 @@
+/*
+ Name:		PCF8574LCDDualController.cpp
+ Created:	16/10/2026 10:41:13 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDDualController.h"
+
+template class BasicPCF8574DualLCDController<PCF8574WireTransport<Wire>>;
+template class BasicPCF8574DualLCDController<PCF8574BufferedWireTransport<Wire>>;
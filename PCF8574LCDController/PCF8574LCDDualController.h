@@ -0,0 +1,357 @@
+/*
+ Name:		PCF8574LCDDualController.h
+ Created:	16/10/2026 10:41:13 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDDualController_h
+#define _PCF8574LCDDualController_h
+
+#include "PCF8574LCDController.h"
+
+inline namespace PCF8574_LCD_STATISTICS_NAMESPACE
+{
+
+/// <summary>
+/// Controller of display with two LCD controllers sharing data lines, like 40x4 display, where each LCD controller has its own E line
+/// connected to other pin of PCF8574. First LCD controller shows lines 0 and 1, second one shows lines 2 and 3.
+/// Each LCD controller has its own execution timer, so data for one half is sent while other half is still executing its command.
+/// Derives from Print, so all print functions send chars to half with cursor.
+/// </summary>
+template<typename Transport, typename HalfGeometry = PCF8574StaticGeometry<40, 2>, typename PinMap = PCF8574LCDStandardPinMap>
+class BasicPCF8574DualLCDController final : public Print
+{
+public:
+	using Controller = BasicPCF8574LCDController<Transport, HalfGeometry, PinMap>;
+	using BusyCheckMode = PCF8574LCDBusyCheckMode;
+
+	/// <summary>
+	/// Clears both halves. Second half is cleared while first one is still executing clear display.
+	/// </summary>
+	void clearDisplay(void) { m_halves[0].clearDisplay(); m_halves[1].clearDisplay(); m_activeHalf = 0; updateCursor(); }
+
+	/// <summary>
+	/// Moves cursor to home position (first char in first line) and cancels display shift of both halves.
+	/// </summary>
+	void moveToHome(void) { m_halves[0].moveToHome(); m_halves[1].moveToHome(); m_activeHalf = 0; updateCursor(); }
+
+	/// <summary>
+	/// Disables both halves (clear without delete).
+	/// </summary>
+	void disableDisplay(void) { m_halves[0].disableDisplay(); m_halves[1].disableDisplay(); }
+
+	/// <summary>
+	/// Enables both halves.
+	/// </summary>
+	void enableDisplay(void) { m_halves[0].enableDisplay(); m_halves[1].enableDisplay(); }
+
+	/// <summary>
+	/// Disables displaying of cursor.
+	/// </summary>
+	void disableCursor(void) { m_cursorEnabled = false; updateCursor(); }
+
+	/// <summary>
+	/// Enables displaying of cursor. Cursor is shown only by half with cursor.
+	/// </summary>
+	void enableCursor(void) { m_cursorEnabled = true; updateCursor(); }
+
+	/// <summary>
+	/// Disables blinking of last entered char.
+	/// </summary>
+	void disableBlinking(void) { m_blinkingEnabled = false; updateCursor(); }
+
+	/// <summary>
+	/// Enables blinking of last entered char. Only half with cursor blinks.
+	/// </summary>
+	void enableBlinking(void) { m_blinkingEnabled = true; updateCursor(); }
+
+	/// <summary>
+	/// Shifts both halves one char to left.
+	/// </summary>
+	void shiftDisplayToLeft(void) { m_halves[0].shiftDisplayToLeft(); m_halves[1].shiftDisplayToLeft(); }
+
+	/// <summary>
+	/// Shifts both halves one char to right.
+	/// </summary>
+	void shiftDisplayToRight(void) { m_halves[0].shiftDisplayToRight(); m_halves[1].shiftDisplayToRight(); }
+
+	/// <summary>
+	/// Sets cursor to given position. Half showing given line becomes half with cursor.
+	/// </summary>
+	/// <param name="x">Char position</param>
+	/// <param name="y">Line (from 0 to 3)</param>
+	void setCursorToPosition(const uint8_t& x, const uint8_t& y);
+
+	/// <summary>
+	/// Sends data to half with cursor.
+	/// </summary>
+	/// <param name="dataToDisplay">String to display</param>
+	void displayData(const char dataToDisplay[]) { m_halves[m_activeHalf].displayData(dataToDisplay); }
+
+	/// <summary>
+	/// Sends given number of chars to half with cursor. Chars may include custom char 0.
+	/// </summary>
+	/// <param name="dataToDisplay">Chars to display</param>
+	/// <param name="length">Number of chars</param>
+	void displayData(const char dataToDisplay[], const uint8_t& length) { m_halves[m_activeHalf].displayData(dataToDisplay, length); }
+
+	/// <summary>
+	/// Sends string stored in program memory to half with cursor, for example F("text").
+	/// </summary>
+	/// <param name="dataToDisplay">String in program memory</param>
+	void displayData(const __FlashStringHelper* dataToDisplay) { m_halves[m_activeHalf].displayData(dataToDisplay); }
+
+	/// <summary>
+	/// Sends given number of chars stored in program memory (PROGMEM) to half with cursor.
+	/// </summary>
+	/// <param name="dataToDisplay">Chars in program memory</param>
+	/// <param name="length">Number of chars</param>
+	void displayDataFromFlash(const char dataToDisplay[], const uint8_t& length) { m_halves[m_activeHalf].displayDataFromFlash(dataToDisplay, length); }
+
+	/// <summary>
+	/// Sends data to half with cursor.
+	/// </summary>
+	/// <param name="dataToDisplay">Char to display</param>
+	void displayData(const char& dataToDisplay) { m_halves[m_activeHalf].displayData(dataToDisplay); }
+
+	/// <summary>
+	/// Sends one char to half with cursor. Used by print functions.
+	/// </summary>
+	/// <param name="data">Char to display</param>
+	/// <returns>Number of sent chars</returns>
+	size_t write(uint8_t data) { return m_halves[m_activeHalf].write(data); }
+
+	/// <summary>
+	/// Sends given number of chars to half with cursor in burst mode. Used by print functions.
+	/// </summary>
+	/// <param name="buffer">Chars to display</param>
+	/// <param name="size">Number of chars</param>
+	/// <returns>Number of sent chars</returns>
+	size_t write(const uint8_t* buffer, size_t size) { return m_halves[m_activeHalf].write(buffer, size); }
+
+	using Print::write;
+
+	/// <summary>
+	/// Writes given char of size 5x8 to CGRAM of both halves, so it may be displayed on every line.
+	/// </summary>
+	/// <param name="charPosition">Char position (from 0 to 7)</param>
+	/// <param name="data">New char data array</param>
+	void write5x8CharDataToCGRAM(const uint8_t& charPosition, const uint8_t data[]) { m_halves[0].write5x8CharDataToCGRAM(charPosition, data); m_halves[1].write5x8CharDataToCGRAM(charPosition, data); }
+
+	/// <summary>
+	/// Writes given number of bytes to CGRAM of both halves, starting from given address.
+	/// </summary>
+	/// <param name="address">Starting address in CGRAM</param>
+	/// <param name="data">Data to write</param>
+	/// <param name="length">Number of bytes</param>
+	void writeDataToCGRAM(const uint8_t& address, const uint8_t data[], const uint8_t& length) { m_halves[0].writeDataToCGRAM(address, data, length); m_halves[1].writeDataToCGRAM(address, data, length); }
+
+	/// <summary>
+	/// Erases line by writing blanks on whole line. After that it will set cursor to beginning of chosen line.
+	/// </summary>
+	/// <param name="lineNumber">Line to erase</param>
+	void eraseLine(const uint8_t& lineNumber) { if (lineNumber >= getDisplaySizeY()) return; setCursorToPosition(0, lineNumber); m_halves[m_activeHalf].eraseLine(lineNumber - m_activeHalf * m_halves[0].getDisplaySizeY()); }
+
+	/// <summary>
+	/// Enables backlight.
+	/// </summary>
+	/// <returns>True if changed successfuly</returns>
+	bool enableBacklight(void) { m_halves[1].enableBacklight(); return m_halves[0].enableBacklight(); }
+
+	/// <summary>
+	/// Disables backlight.
+	/// </summary>
+	/// <returns>True if changed successfuly</returns>
+	bool disableBacklight(void) { m_halves[1].disableBacklight(); return m_halves[0].disableBacklight(); }
+
+	/// <summary>
+	/// Returns status of interface data lenght, display lines and font.
+	/// </summary>
+	/// <returns>Byte formatted as in controller documentation</returns>
+	uint8_t getCurrentFunctionSet(void) { return m_halves[0].getCurrentFunctionSet(); }
+
+	/// <summary>
+	/// Returns number of chars in line.
+	/// </summary>
+	/// <returns>Chars in line</returns>
+	uint8_t getDisplaySizeX(void) { return m_halves[0].getDisplaySizeX(); }
+
+	/// <summary>
+	/// Returns number of lines.
+	/// </summary>
+	/// <returns>Lines count</returns>
+	uint8_t getDisplaySizeY(void) { return m_halves[0].getDisplaySizeY() * 2; }
+
+	/// <summary>
+	/// Sets way of waiting for completion of previous command for both halves. Display with E line on R/W pin always uses Timed mode.
+	/// </summary>
+	/// <param name="newMode">New busy check mode</param>
+	void setBusyCheckMode(const BusyCheckMode& newMode)
+	{
+		const BusyCheckMode usableMode = getUsableBusyCheckMode(newMode, m_enableLines);
+		m_halves[0].setBusyCheckMode(usableMode);
+		m_halves[1].setBusyCheckMode(usableMode);
+	}
+
+	/// <summary>
+	/// Sets asynchronous mode of both halves.
+	/// </summary>
+	/// <param name="enabled">True to enable asynchronous mode</param>
+	void setAsynchronousMode(const bool& enabled) { m_halves[0].setAsynchronousMode(enabled); m_halves[1].setAsynchronousMode(enabled); }
+
+	/// <summary>
+	/// Sends next queued work of each half that is ready. Never waits.
+	/// </summary>
+	/// <returns>True if there is still work to do</returns>
+	bool tick(void) { bool firstPending = m_halves[0].tick(); return m_halves[1].tick() || firstPending; }
+
+	/// <summary>
+	/// Checks if initialization of any half is not finished or its queue is not empty.
+	/// </summary>
+	/// <returns>True if there is work for tick</returns>
+	bool hasPendingWork(void) { return m_halves[0].hasPendingWork() || m_halves[1].hasPendingWork(); }
+
+	/// <summary>
+	/// Calls tick until both halves are initialized and their queues are empty.
+	/// </summary>
+	void completeQueuedCommands(void) { while (tick()) { asm("nop"); } }
+
+	/// <summary>
+	/// Sends transmissions deferred by transport.
+	/// </summary>
+	void sendBufferedData(void) { m_halves[0].sendBufferedData(); }
+
+	/// <summary>
+	/// Returns state of initialization.
+	/// </summary>
+	/// <returns>True if both halves are initialized</returns>
+	bool isInitialized(void) { return m_halves[0].isInitialized() && m_halves[1].isInitialized(); }
+
+	/// <summary>
+	/// Returns controller of given half, for example for adding it to PCF8574LCDBusScheduler.
+	/// When one of E lines is on R/W pin, reads of half are disabled, so its busy check mode stays Timed.
+	/// </summary>
+	/// <param name="half">0 = lines 0 and 1, 1 = lines 2 and 3</param>
+	/// <returns>Controller of half</returns>
+	Controller& getHalf(const uint8_t& half) { return m_halves[half & 0x01]; }
+
+	/// <summary>
+	/// Constructor for dual controller display. Both halves are initialized together, so their power on and initialization waits overlap.
+	/// </summary>
+	/// <param name="pcf8574Address">I2C address of PCF8574</param>
+	/// <param name="secondEnableLine">Mask of PCF8574 pin connected to E line of second LCD controller. If it is R/W pin (0x02), R/W line must be tied low and Timed mode must be used</param>
+	/// <param name="busyCheckMode">Way of waiting for completion of commands. Timed mode is used when one of E lines is on R/W pin</param>
+	/// <param name="asynchronousMode">True = constructor returns immediately, initialization and all commands are performed by tick</param>
+	/// <param name="firstEnableLine">Mask of PCF8574 pin connected to E line of first LCD controller</param>
+	BasicPCF8574DualLCDController(const uint8_t& pcf8574Address, const uint8_t& secondEnableLine, BusyCheckMode busyCheckMode = BusyCheckMode::Timed,
+		const bool& asynchronousMode = false, const uint8_t& firstEnableLine = PinMap::enable);
+
+	BasicPCF8574DualLCDController(const BasicPCF8574DualLCDController&) = delete;
+	BasicPCF8574DualLCDController& operator=(const BasicPCF8574DualLCDController&) = delete;
+
+private:
+	/// <summary>
+	/// Controllers of both halves.
+	/// </summary>
+	Controller m_halves[2];
+
+	/// <summary>
+	/// Half with cursor, which receives data.
+	/// </summary>
+	uint8_t m_activeHalf = 0;
+
+	/// <summary>
+	/// State of cursor.
+	/// </summary>
+	bool m_cursorEnabled = false;
+
+	/// <summary>
+	/// State of blinking.
+	/// </summary>
+	bool m_blinkingEnabled = false;
+
+	/// <summary>
+	/// Masks of PCF8574 pins connected to E lines of both LCD controllers.
+	/// </summary>
+	const uint8_t m_enableLines;
+
+private:
+	/// <summary>
+	/// Shows cursor and blinking only on half with cursor.
+	/// </summary>
+	void updateCursor(void);
+
+	/// <summary>
+	/// Returns busy check mode possible with given E lines. Reading of busy flag sets R/W pin high, which would strobe E line placed on it.
+	/// </summary>
+	/// <param name="mode">Requested busy check mode</param>
+	/// <param name="enableLines">Masks of pins connected to E lines</param>
+	/// <returns>Requested mode, or Timed mode if one of E lines is on R/W pin</returns>
+	static BusyCheckMode getUsableBusyCheckMode(const BusyCheckMode& mode, const uint8_t& enableLines) { return enableLines & PinMap::readWrite ? BusyCheckMode::Timed : mode; }
+};
+
+template<typename Transport, typename HalfGeometry, typename PinMap>
+BasicPCF8574DualLCDController<Transport, HalfGeometry, PinMap>::BasicPCF8574DualLCDController(const uint8_t& pcf8574Address, const uint8_t& secondEnableLine,
+	BusyCheckMode busyCheckMode, const bool& asynchronousMode, const uint8_t& firstEnableLine) :
+	m_halves{ { pcf8574Address, getUsableBusyCheckMode(busyCheckMode, firstEnableLine | secondEnableLine), true, firstEnableLine },
+		{ pcf8574Address, getUsableBusyCheckMode(busyCheckMode, firstEnableLine | secondEnableLine), true, secondEnableLine } },
+	m_enableLines(firstEnableLine | secondEnableLine)
+{
+	if (m_enableLines & PinMap::readWrite)//halves returned by getHalf must not read either
+	{
+		m_halves[0].disableReads();
+		m_halves[1].disableReads();
+	}
+	if (asynchronousMode) return;
+
+	completeQueuedCommands();//both halves are initialized by ticks, so their waits overlap
+	setAsynchronousMode(false);
+}
+
+template<typename Transport, typename HalfGeometry, typename PinMap>
+void BasicPCF8574DualLCDController<Transport, HalfGeometry, PinMap>::setCursorToPosition(const uint8_t& x, const uint8_t& y)
+{
+	if (y >= getDisplaySizeY()) return;
+
+	uint8_t half = y >= m_halves[0].getDisplaySizeY() ? 1 : 0;
+
+	m_halves[half].setCursorToPosition(x, y - half * m_halves[0].getDisplaySizeY());
+	if (half == m_activeHalf) return;
+
+	m_activeHalf = half;
+	if (m_cursorEnabled || m_blinkingEnabled) updateCursor();//cursor is moved to other half
+}
+
+template<typename Transport, typename HalfGeometry, typename PinMap>
+void BasicPCF8574DualLCDController<Transport, HalfGeometry, PinMap>::updateCursor(void)
+{
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		Controller& half = m_halves[i];
+
+		if (i == m_activeHalf && m_cursorEnabled) half.enableCursor();
+		else half.disableCursor();
+
+		if (i == m_activeHalf && m_blinkingEnabled) half.enableBlinking();
+		else half.disableBlinking();
+	}
+}
+
+} // namespace PCF8574_LCD_STATISTICS_NAMESPACE
+
+/// <summary>
+/// 40x4 display with two LCD controllers, sending each transmission immediately through Wire.
+/// </summary>
+typedef BasicPCF8574DualLCDController<PCF8574WireTransport<Wire>> PCF8574DualLCDController;
+
+/// <summary>
+/// 40x4 display with two LCD controllers, joining transmissions through Wire until sendBufferedData is called.
+/// </summary>
+typedef BasicPCF8574DualLCDController<PCF8574BufferedWireTransport<Wire>> PCF8574BufferedDualLCDController;
+
+extern template class BasicPCF8574DualLCDController<PCF8574WireTransport<Wire>>;
+extern template class BasicPCF8574DualLCDController<PCF8574BufferedWireTransport<Wire>>;
+
+#endif
@@ -0,0 +1,274 @@
+/*
+ Name:		PCF8574LCDEmulator.cpp
+ Created:	16/10/2026 11:12:05 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDEmulator.h"
+
+void PCF8574LCDEmulator::beginTransmission(const uint8_t& address)
+{
+	m_transmissionOpen = address == m_pcfAddress;
+	transferBytes(1);//address byte
+}
+
+void PCF8574LCDEmulator::write(const uint8_t& data)
+{
+	transferBytes(1);
+	if (m_transmissionOpen) setPort(data, m_time);
+}
+
+bool PCF8574LCDEmulator::read(const uint8_t& address, uint8_t& data)
+{
+	transferBytes(2);//address byte and port byte
+	if (address != m_pcfAddress) return false;
+
+	data = m_port;
+	if ((m_port & m_enableLine) && (m_port & m_readWriteLine)) data &= getDataPins(getOutputNibble(m_port & m_registerSelectLine, m_time)) | ~getDataPins(0xF0);//quasi-bidirectional pins: low latch wins
+	return true;
+}
+
+void PCF8574LCDEmulator::powerOn(void)
+{
+	memset(m_ddram, ' ', sizeof(m_ddram));//internal reset clears display
+	memset(m_cgram, 0x00, sizeof(m_cgram));
+
+	m_port = 0xFF;//PCF8574 starts with all pins high
+	m_latchedControl = m_registerSelectLine | m_readWriteLine;//R/W and RS lines are high as E line
+	m_lowerNibble = false;
+	m_8bitInterface = true;
+	m_twoLines = false;
+	m_addressCounter = 0;
+	m_addressInCGRAM = false;
+	m_dataRegister = ' ';
+	m_entryMode = 0x02;
+	m_displayControl = 0;
+	m_displayShift = 0;
+	m_resetFunctionSets = 0;
+	m_transmissionOpen = false;
+
+	m_powerOnTime = getTime();
+	m_busyEndTime = m_powerOnTime + m_powerOnWait;//busy flag is set during internal reset
+	clearViolations();
+}
+
+void PCF8574LCDEmulator::getScreenLine(const uint8_t& line, char text[])
+{
+	for (uint8_t x = 0; x < m_columns; x++)
+	{
+		uint8_t code = getScreenChar(x, line);
+
+		if (code < 0x10) text[x] = '*';
+		else if (code == 0xFF) text[x] = '#';
+		else if (code < 0x20 || code > 0x7D) text[x] = '?';
+		else text[x] = code;
+	}
+
+	text[m_columns] = '\0';
+}
+
+uint8_t PCF8574LCDEmulator::getScreenChar(const uint8_t& x, const uint8_t& y)
+{
+	if (!(m_displayControl & 0x04) || x >= m_columns || y >= m_lines) return ' ';
+
+	if (!m_twoLines) return m_ddram[(x + m_displayShift) % 80];//one line: 0x00-0x4F
+
+	uint8_t column = (x + (y & 0x02 ? m_columns : 0) + m_displayShift) % 40;//lines 2 and 3 continue lines 0 and 1
+	return m_ddram[(y & 0x01 ? 0x40 : 0x00) + column];
+}
+
+void PCF8574LCDEmulator::setPort(const uint8_t& port, const unsigned long& time)
+{
+	const uint8_t previousPort = m_port;
+	m_port = port;
+
+	if (!(previousPort & m_enableLine) && (port & m_enableLine))//rising edge
+	{
+		m_latchedControl = port & (m_registerSelectLine | m_readWriteLine);
+		return;
+	}
+	if (!(previousPort & m_enableLine) || (port & m_enableLine)) return;
+
+	//falling edge
+	if ((previousPort & (m_registerSelectLine | m_readWriteLine)) != m_latchedControl) reportViolation(Violation::ControlChangedWhileEnabled);
+
+	if (m_latchedControl & m_readWriteLine) readNibble(m_latchedControl & m_registerSelectLine, time);
+	else writeNibble(m_latchedControl & m_registerSelectLine, getDataLines(previousPort), time);//data lines are latched while E line is high
+}
+
+uint8_t PCF8574LCDEmulator::getDataLines(const uint8_t& port)
+{
+	uint8_t dataLines = 0;
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (port & m_dataLines[i]) dataLines |= 0x10 << i;
+	}
+
+	return dataLines;
+}
+
+uint8_t PCF8574LCDEmulator::getDataPins(const uint8_t& dataLines)
+{
+	uint8_t pins = 0;
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (dataLines & (0x10 << i)) pins |= m_dataLines[i];
+	}
+
+	return pins;
+}
+
+void PCF8574LCDEmulator::writeNibble(const bool& registerSelect, const uint8_t& nibble, const unsigned long& time)
+{
+	if (time - m_powerOnTime < m_powerOnWait)//internal reset ignores instructions
+	{
+		reportViolation(Violation::AccessBeforePowerOn);
+		return;
+	}
+	if (isBusyAt(time)) reportViolation(Violation::WriteWhileBusy);
+
+	if (m_8bitInterface)//D3-D0 are not connected and read as low
+	{
+		execute(registerSelect, nibble, time);
+		return;
+	}
+
+	if (!m_lowerNibble)
+	{
+		m_upperNibble = nibble;
+		m_lowerNibble = true;
+		return;
+	}
+
+	m_lowerNibble = false;
+	execute(registerSelect, m_upperNibble | (nibble >> 4), time);
+}
+
+void PCF8574LCDEmulator::readNibble(const bool& registerSelect, const unsigned long& time)
+{
+	if (time - m_powerOnTime < m_powerOnWait) return;//internal reset ignores reads
+
+	if (!m_8bitInterface)
+	{
+		m_lowerNibble = !m_lowerNibble;
+		if (m_lowerNibble) return;
+	}
+	if (!registerSelect) return;//busy flag and address may be read at any time
+
+	if (isBusyAt(time)) reportViolation(Violation::ReadDataWhileBusy);
+
+	moveAddressCounter(m_entryMode & 0x02);
+	loadDataRegister();
+	startExecution(time, 41);//37us and 4us of address counter update
+}
+
+uint8_t PCF8574LCDEmulator::getOutputNibble(const bool& registerSelect, const unsigned long& time)
+{
+	uint8_t output = registerSelect ? m_dataRegister : (isBusyAt(time) ? 0x80 : 0x00) | m_addressCounter;
+
+	if (!m_8bitInterface && m_lowerNibble) output <<= 4;
+	return output & 0xF0;
+}
+
+void PCF8574LCDEmulator::execute(const bool& registerSelect, const uint8_t& data, const unsigned long& time)
+{
+	if (registerSelect)
+	{
+		if (m_addressInCGRAM) m_cgram[m_addressCounter & 0x3F] = data;
+		else m_ddram[m_addressCounter & 0x7F] = data;
+
+		moveAddressCounter(m_entryMode & 0x02);
+		if ((m_entryMode & 0x01) && !m_addressInCGRAM) shiftDisplay(m_entryMode & 0x02);
+		startExecution(time, 41);//37us and 4us of address counter update
+		return;
+	}
+
+	uint16_t executionTime = 37;
+
+	if (data & 0x80)//set DDRAM address
+	{
+		m_addressCounter = data & 0x7F;
+		m_addressInCGRAM = false;
+		loadDataRegister();
+	}
+	else if (data & 0x40)//set CGRAM address
+	{
+		m_addressCounter = data & 0x3F;
+		m_addressInCGRAM = true;
+		loadDataRegister();
+	}
+	else if (data & 0x20)//function set
+	{
+		if (m_8bitInterface)//first function sets of initialization by instruction need longer waits
+		{
+			if (m_resetFunctionSets == 0) executionTime = 4100;
+			else if (m_resetFunctionSets == 1) executionTime = 100;
+			if (m_resetFunctionSets < 0xFF) m_resetFunctionSets++;
+		}
+
+		m_8bitInterface = data & 0x10;
+		m_twoLines = data & 0x08;
+		m_lowerNibble = false;
+	}
+	else if (data & 0x10)//cursor or display shift
+	{
+		if (data & 0x08) shiftDisplay(!(data & 0x04));
+		else moveAddressCounter(data & 0x04);
+	}
+	else if (data & 0x08) m_displayControl = data & 0x07;
+	else if (data & 0x04) m_entryMode = data & 0x03;
+	else if (data & 0x02)//return home
+	{
+		m_addressCounter = 0;
+		m_addressInCGRAM = false;
+		m_displayShift = 0;
+		executionTime = 1520;
+	}
+	else if (data & 0x01)//clear display
+	{
+		memset(m_ddram, ' ', sizeof(m_ddram));
+		m_addressCounter = 0;
+		m_addressInCGRAM = false;
+		m_displayShift = 0;
+		m_entryMode |= 0x02;//clear display sets increment mode
+		executionTime = 1520;
+	}
+
+	startExecution(time, executionTime);
+}
+
+void PCF8574LCDEmulator::moveAddressCounter(const bool& increment)
+{
+	if (m_addressInCGRAM)
+	{
+		m_addressCounter = (m_addressCounter + (increment ? 1 : 0x3F)) & 0x3F;
+		return;
+	}
+
+	if (!m_twoLines)//one line: 0x00-0x4F
+	{
+		m_addressCounter = increment ? (m_addressCounter >= 0x4F ? 0x00 : m_addressCounter + 1) : (m_addressCounter == 0x00 ? 0x4F : m_addressCounter - 1);
+		return;
+	}
+
+	if (increment)//two lines: 0x00-0x27 and 0x40-0x67, end of one line wraps to other one
+	{
+		if (m_addressCounter == 0x27) m_addressCounter = 0x40;
+		else if (m_addressCounter >= 0x67) m_addressCounter = 0x00;
+		else m_addressCounter++;
+	}
+	else
+	{
+		if (m_addressCounter == 0x40) m_addressCounter = 0x27;
+		else if (m_addressCounter == 0x00) m_addressCounter = 0x67;
+		else m_addressCounter--;
+	}
+}
+
+void PCF8574LCDEmulator::shiftDisplay(const bool& left)
+{
+	const uint8_t lineLength = m_twoLines ? 40 : 80;
+	m_displayShift = left ? (m_displayShift + 1) % lineLength : (m_displayShift + lineLength - 1) % lineLength;
+}
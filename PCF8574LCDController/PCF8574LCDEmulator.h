@@ -0,0 +1,504 @@
+/*
+ Name:		PCF8574LCDEmulator.h
+ Created:	16/10/2026 11:12:05 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDEmulator_h
+#define _PCF8574LCDEmulator_h
+
+#include "PCF8574LCDController.h"
+
+/// <summary>
+/// Timing or protocol error detected by emulator.
+/// </summary>
+enum class PCF8574LCDEmulatorViolation : uint8_t
+{
+	None,
+	AccessBeforePowerOn,//instruction or data written before power on wait of LCD controller passed
+	WriteWhileBusy,//nibble written while previous instruction was executed
+	ReadDataWhileBusy,//data read while previous instruction was executed, busy flag may be read at any time
+	ControlChangedWhileEnabled//RS or R/W line changed while E line was high
+};
+
+/// <summary>
+/// Emulator of PCF8574 port with HD44780 connected to it, for testing without display, for example on host computer.
+/// Bytes written to port are followed edge by edge: nibbles are latched on falling edges of E line, in 8bit mode after power on and in 4bit mode
+/// after function set, with the same nibble order for reads and writes. DDRAM, CGRAM, address counter, entry mode, display shift and display
+/// control are kept as in LCD controller, and each instruction makes controller busy for its execution time, so instructions sent too early
+/// are reported as violations. Time of emulator follows micros() and each byte on I2C bus adds its transfer time at given bus clock,
+/// so micros() of host should include getBusTime() if timed busy check mode is tested.
+/// </summary>
+class PCF8574LCDEmulator final
+{
+public:
+	using Violation = PCF8574LCDEmulatorViolation;
+
+	/// <summary>
+	/// Starts I2C transmission. Transmissions to other devices are ignored.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	void beginTransmission(const uint8_t& address);
+
+	/// <summary>
+	/// Writes byte to port of PCF8574 in current transmission.
+	/// </summary>
+	/// <param name="data">New state of port</param>
+	void write(const uint8_t& data);
+
+	/// <summary>
+	/// Ends I2C transmission.
+	/// </summary>
+	void endTransmission(void) { m_transmissionOpen = false; }
+
+	/// <summary>
+	/// Reads port of PCF8574. Data lines with high state are driven by LCD controller while E line is high and R/W line is set.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	/// <param name="data">State of port</param>
+	/// <returns>True if address belongs to emulated device</returns>
+	bool read(const uint8_t& address, uint8_t& data);
+
+	/// <summary>
+	/// Turns power of display off and on, so LCD controller starts in 8bit mode with cleared DDRAM and power on wait.
+	/// </summary>
+	void powerOn(void);
+
+	/// <summary>
+	/// Renders visible line of display as text. Chars from CGRAM are shown as '*', full block as '#', and other chars above ASCII as '?'.
+	/// Display turned off is shown as spaces.
+	/// </summary>
+	/// <param name="line">Line of display</param>
+	/// <param name="text">Buffer for chars of line and terminating zero</param>
+	void getScreenLine(const uint8_t& line, char text[]);
+
+	/// <summary>
+	/// Returns code of char visible on given position of display, with display shift.
+	/// </summary>
+	/// <param name="x">Char position in line</param>
+	/// <param name="y">Line of display</param>
+	/// <returns>Char code</returns>
+	uint8_t getScreenChar(const uint8_t& x, const uint8_t& y);
+
+	/// <summary>
+	/// Returns byte of DDRAM.
+	/// </summary>
+	/// <param name="address">DDRAM address</param>
+	/// <returns>Byte at address</returns>
+	uint8_t getDDRAM(const uint8_t& address) { return m_ddram[address & 0x7F]; }
+
+	/// <summary>
+	/// Returns byte of CGRAM.
+	/// </summary>
+	/// <param name="address">CGRAM address</param>
+	/// <returns>Byte at address</returns>
+	uint8_t getCGRAM(const uint8_t& address) { return m_cgram[address & 0x3F]; }
+
+	/// <summary>
+	/// Returns address counter of LCD controller.
+	/// </summary>
+	/// <returns>Address in DDRAM or CGRAM</returns>
+	uint8_t getAddressCounter(void) { return m_addressCounter; }
+
+	/// <summary>
+	/// Returns display shift, in chars moved to the left.
+	/// </summary>
+	/// <returns>Display shift</returns>
+	uint8_t getDisplayShift(void) { return m_displayShift; }
+
+	/// <summary>
+	/// Returns state of backlight.
+	/// </summary>
+	/// <returns>True if backlight is on</returns>
+	bool isBacklightEnabled(void) { return m_port & m_backlightLine; }
+
+	/// <summary>
+	/// Returns state of busy flag.
+	/// </summary>
+	/// <returns>True if LCD controller executes instruction</returns>
+	bool isBusy(void) { return isBusyAt(getTime()); }
+
+	/// <summary>
+	/// Returns number of violations since power on or last clear.
+	/// </summary>
+	/// <returns>Number of violations</returns>
+	unsigned long getViolationsCount(void) { return m_violationsCount; }
+
+	/// <summary>
+	/// Returns last violation since power on or last clear.
+	/// </summary>
+	/// <returns>Type of violation</returns>
+	Violation getLastViolation(void) { return m_lastViolation; }
+
+	/// <summary>
+	/// Clears violations.
+	/// </summary>
+	void clearViolations(void) { m_violationsCount = 0; m_lastViolation = Violation::None; }
+
+	/// <summary>
+	/// Returns number of bytes transferred on I2C bus, including address bytes.
+	/// </summary>
+	/// <returns>Number of bytes</returns>
+	unsigned long getBusBytes(void) { return m_busBytes; }
+
+	/// <summary>
+	/// Returns time taken by bytes transferred on I2C bus.
+	/// </summary>
+	/// <returns>Time in microseconds</returns>
+	unsigned long getBusTime(void) { return m_busBytes * m_byteTime; }
+
+	/// <summary>
+	/// Sets clock of I2C bus used for transfer time of bytes.
+	/// </summary>
+	/// <param name="clock">Clock in Hz, 0 = bytes take no time</param>
+	void setBusClock(const unsigned long& clock) { m_byteTime = clock ? 9000000UL / clock : 0; }//8 bits and acknowledge
+
+	/// <summary>
+	/// Sets wiring of port to LCD given by pin map, like pin map of tested controller. Emulator starts with PCF8574LCDStandardPinMap
+	/// and E line given to constructor.
+	/// </summary>
+	template<typename PinMap>
+	void setPinMap(void);
+
+	/// <summary>
+	/// Constructor for emulator. Display is powered on.
+	/// </summary>
+	/// <param name="columns">Chars in line of display</param>
+	/// <param name="lines">Lines of display</param>
+	/// <param name="pcf8574Address">I2C address of emulated PCF8574</param>
+	/// <param name="oscillatorFrequency">Frequency of oscillator of LCD controller in kHz, execution times are scaled from 270kHz</param>
+	/// <param name="enableLine">Mask of PCF8574 pin connected to E line of LCD controller</param>
+	PCF8574LCDEmulator(const uint8_t& columns, const uint8_t& lines, const uint8_t& pcf8574Address = PCF8574_DEFAULT_ADDRESS,
+		const uint16_t& oscillatorFrequency = 270, const uint8_t& enableLine = PCF8574_LCD_ENABLE_LINE) :
+		m_columns(columns), m_lines(lines), m_pcfAddress(pcf8574Address), m_oscillatorFrequency(oscillatorFrequency), m_enableLine(enableLine) { powerOn(); }
+
+	PCF8574LCDEmulator(const PCF8574LCDEmulator&) = delete;
+	PCF8574LCDEmulator& operator=(const PCF8574LCDEmulator&) = delete;
+
+private:
+	/// <summary>
+	/// Chars in line of display.
+	/// </summary>
+	const uint8_t m_columns;
+
+	/// <summary>
+	/// Lines of display.
+	/// </summary>
+	const uint8_t m_lines;
+
+	/// <summary>
+	/// I2C address of emulated PCF8574.
+	/// </summary>
+	const uint8_t m_pcfAddress;
+
+	/// <summary>
+	/// Frequency of oscillator in kHz.
+	/// </summary>
+	const uint16_t m_oscillatorFrequency;
+
+	/// <summary>
+	/// Mask of PCF8574 pin connected to E line.
+	/// </summary>
+	uint8_t m_enableLine;
+
+	/// <summary>
+	/// Mask of PCF8574 pin connected to RS line.
+	/// </summary>
+	uint8_t m_registerSelectLine = PCF8574LCDStandardPinMap::registerSelect;
+
+	/// <summary>
+	/// Mask of PCF8574 pin connected to R/W line, 0 if R/W line is tied low.
+	/// </summary>
+	uint8_t m_readWriteLine = PCF8574LCDStandardPinMap::readWrite;
+
+	/// <summary>
+	/// Mask of PCF8574 pin switching backlight.
+	/// </summary>
+	uint8_t m_backlightLine = PCF8574LCDStandardPinMap::backlight;
+
+	/// <summary>
+	/// Masks of PCF8574 pins connected to D4-D7 lines.
+	/// </summary>
+	uint8_t m_dataLines[4] = { 0x10, 0x20, 0x40, 0x80 };
+
+	/// <summary>
+	/// DDRAM, indexed by address.
+	/// </summary>
+	uint8_t m_ddram[0x80];
+
+	/// <summary>
+	/// CGRAM.
+	/// </summary>
+	uint8_t m_cgram[0x40];
+
+	/// <summary>
+	/// Output latch of PCF8574 port.
+	/// </summary>
+	uint8_t m_port = 0xFF;
+
+	/// <summary>
+	/// RS and R/W lines at rising edge of E line.
+	/// </summary>
+	uint8_t m_latchedControl = 0;
+
+	/// <summary>
+	/// Upper nibble written in 4bit mode.
+	/// </summary>
+	uint8_t m_upperNibble = 0;
+
+	/// <summary>
+	/// True if next nibble in 4bit mode is the lower one.
+	/// </summary>
+	bool m_lowerNibble = false;
+
+	/// <summary>
+	/// Interface data length, true = 8bit.
+	/// </summary>
+	bool m_8bitInterface = true;
+
+	/// <summary>
+	/// Number of display lines of function set, true = two lines.
+	/// </summary>
+	bool m_twoLines = false;
+
+	/// <summary>
+	/// Address counter.
+	/// </summary>
+	uint8_t m_addressCounter = 0;
+
+	/// <summary>
+	/// True if address counter points to CGRAM.
+	/// </summary>
+	bool m_addressInCGRAM = false;
+
+	/// <summary>
+	/// Data register, loaded from RAM by setting address and by reading.
+	/// </summary>
+	uint8_t m_dataRegister = 0;
+
+	/// <summary>
+	/// Entry mode: I/D (0x02) and S (0x01).
+	/// </summary>
+	uint8_t m_entryMode = 0x02;
+
+	/// <summary>
+	/// Display control: D (0x04), C (0x02) and B (0x01).
+	/// </summary>
+	uint8_t m_displayControl = 0;
+
+	/// <summary>
+	/// Display shift, in chars moved to the left.
+	/// </summary>
+	uint8_t m_displayShift = 0;
+
+	/// <summary>
+	/// Number of function sets received in 8bit mode since power on, they start initialization by instruction.
+	/// </summary>
+	uint8_t m_resetFunctionSets = 0;
+
+	/// <summary>
+	/// Time in microseconds when display was powered on.
+	/// </summary>
+	unsigned long m_powerOnTime = 0;
+
+	/// <summary>
+	/// Time in microseconds when current instruction ends.
+	/// </summary>
+	unsigned long m_busyEndTime = 0;
+
+	/// <summary>
+	/// Time of emulator in microseconds, never behind micros().
+	/// </summary>
+	unsigned long m_time = 0;
+
+	/// <summary>
+	/// Transfer time of one byte on I2C bus in microseconds.
+	/// </summary>
+	uint16_t m_byteTime = 90;//100kHz
+
+	/// <summary>
+	/// Number of bytes transferred on I2C bus.
+	/// </summary>
+	unsigned long m_busBytes = 0;
+
+	/// <summary>
+	/// True if transmission to emulated device is open.
+	/// </summary>
+	bool m_transmissionOpen = false;
+
+	/// <summary>
+	/// Number of violations.
+	/// </summary>
+	unsigned long m_violationsCount = 0;
+
+	/// <summary>
+	/// Last violation.
+	/// </summary>
+	Violation m_lastViolation = Violation::None;
+
+	/// <summary>
+	/// Time after power on when LCD controller accepts instructions, in microseconds.
+	/// </summary>
+	static const uint16_t m_powerOnWait = 40000;
+
+private:
+	/// <summary>
+	/// Returns time of emulator, which is not behind micros().
+	/// </summary>
+	/// <returns>Time in microseconds</returns>
+	unsigned long getTime(void) { unsigned long now = micros(); if (static_cast<long>(now - m_time) > 0) m_time = now; return m_time; }
+
+	/// <summary>
+	/// Moves time of emulator by transfer time of given number of bytes.
+	/// </summary>
+	/// <param name="bytes">Number of bytes on I2C bus</param>
+	void transferBytes(const uint8_t& bytes) { getTime(); m_time += bytes * m_byteTime; m_busBytes += bytes; }
+
+	/// <summary>
+	/// Checks if instruction is executed at given time.
+	/// </summary>
+	/// <param name="time">Time in microseconds</param>
+	/// <returns>True if LCD controller is busy</returns>
+	bool isBusyAt(const unsigned long& time) { return static_cast<long>(m_busyEndTime - time) > 0; }
+
+	/// <summary>
+	/// Makes LCD controller busy for given execution time at 270kHz.
+	/// </summary>
+	/// <param name="time">Time when execution starts</param>
+	/// <param name="executionTime">Execution time in microseconds at 270kHz</param>
+	void startExecution(const unsigned long& time, const uint16_t& executionTime) { m_busyEndTime = time + executionTime * 270UL / m_oscillatorFrequency; }
+
+	/// <summary>
+	/// Records violation.
+	/// </summary>
+	/// <param name="violation">Type of violation</param>
+	void reportViolation(const Violation& violation) { m_violationsCount++; m_lastViolation = violation; }
+
+	/// <summary>
+	/// Handles new state of port written at given time.
+	/// </summary>
+	/// <param name="port">New state of port</param>
+	/// <param name="time">Time in microseconds</param>
+	void setPort(const uint8_t& port, const unsigned long& time);
+
+	/// <summary>
+	/// Returns states of data lines placed on given port.
+	/// </summary>
+	/// <param name="port">State of port</param>
+	/// <returns>Data lines D7-D4 in upper nibble</returns>
+	uint8_t getDataLines(const uint8_t& port);
+
+	/// <summary>
+	/// Returns states of pins connected to data lines.
+	/// </summary>
+	/// <param name="dataLines">Data lines D7-D4 in upper nibble</param>
+	/// <returns>States of pins</returns>
+	uint8_t getDataPins(const uint8_t& dataLines);
+
+	/// <summary>
+	/// Receives nibble written on falling edge of E line, and executes byte when it is complete.
+	/// </summary>
+	/// <param name="registerSelect">State of RS line</param>
+	/// <param name="nibble">Data lines D7-D4 in upper nibble</param>
+	/// <param name="time">Time in microseconds</param>
+	void writeNibble(const bool& registerSelect, const uint8_t& nibble, const unsigned long& time);
+
+	/// <summary>
+	/// Finishes nibble read on falling edge of E line, and moves address counter when data byte is read.
+	/// </summary>
+	/// <param name="registerSelect">State of RS line</param>
+	/// <param name="time">Time in microseconds</param>
+	void readNibble(const bool& registerSelect, const unsigned long& time);
+
+	/// <summary>
+	/// Returns byte placed on data lines by LCD controller, in upper nibble.
+	/// </summary>
+	/// <param name="registerSelect">State of RS line</param>
+	/// <param name="time">Time in microseconds</param>
+	/// <returns>Data lines D7-D4 in upper nibble</returns>
+	uint8_t getOutputNibble(const bool& registerSelect, const unsigned long& time);
+
+	/// <summary>
+	/// Executes instruction or writes data.
+	/// </summary>
+	/// <param name="registerSelect">False = instruction, true = data</param>
+	/// <param name="data">Instruction or data</param>
+	/// <param name="time">Time in microseconds</param>
+	void execute(const bool& registerSelect, const uint8_t& data, const unsigned long& time);
+
+	/// <summary>
+	/// Moves address counter by one, with wrapping of DDRAM lines or CGRAM.
+	/// </summary>
+	/// <param name="increment">True = increment, false = decrement</param>
+	void moveAddressCounter(const bool& increment);
+
+	/// <summary>
+	/// Moves displayed window of DDRAM by one char.
+	/// </summary>
+	/// <param name="left">True = content moves left</param>
+	void shiftDisplay(const bool& left);
+
+	/// <summary>
+	/// Loads data register from RAM pointed by address counter.
+	/// </summary>
+	void loadDataRegister(void) { m_dataRegister = m_addressInCGRAM ? m_cgram[m_addressCounter & 0x3F] : m_ddram[m_addressCounter & 0x7F]; }
+};
+
+template<typename PinMap>
+void PCF8574LCDEmulator::setPinMap(void)
+{
+	m_registerSelectLine = PinMap::registerSelect;
+	m_readWriteLine = PinMap::readWrite;
+	m_enableLine = PinMap::enable;
+	m_backlightLine = PinMap::backlight;
+	for (uint8_t i = 0; i < 4; i++) m_dataLines[i] = PinMap::getLowerNibble(1 << i);
+
+	m_latchedControl = m_registerSelectLine | m_readWriteLine;
+}
+
+/// <summary>
+/// Transport sending transmissions to given emulator instead of I2C bus.
+/// </summary>
+template<PCF8574LCDEmulator& Device>
+class PCF8574EmulatorTransport final
+{
+public:
+	/// <summary>
+	/// Maximum number of bytes in one transmission.
+	/// </summary>
+	static const uint8_t bufferLength = PCF8574_LCD_I2C_BUFFER_LENGTH;
+
+	/// <summary>
+	/// Starts transmission to given device.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	static void beginTransmission(const uint8_t& address) { Device.beginTransmission(address); }
+
+	/// <summary>
+	/// Adds byte to current transmission.
+	/// </summary>
+	/// <param name="data">Byte to send</param>
+	static void write(const uint8_t& data) { Device.write(data); }
+
+	/// <summary>
+	/// Sends current transmission.
+	/// </summary>
+	static void endTransmission(void) { Device.endTransmission(); }
+
+	/// <summary>
+	/// Reads one byte from given device.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	/// <param name="data">Readed byte</param>
+	/// <returns>True if byte was readed</returns>
+	static bool read(const uint8_t& address, uint8_t& data) { return Device.read(address, data); }
+
+	/// <summary>
+	/// Sends all deferred transmissions. Transmissions are never deferred by this transport.
+	/// </summary>
+	static void flush(void) {}
+};
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ Name:		PCF8574LCDFormat.cpp
+ Created:	16/10/2026 05:32:54 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDFormat.h"
+
+uint8_t PCF8574LCDFormat::formatUnsignedNumber(char buffer[], const unsigned long& value, const uint8_t& width, const char& fill)
+{
+	uint8_t position = maxWidth;
+
+	renderDigits(buffer, position, value, 0);
+	return fillField(buffer, position, width, fill);
+}
+
+uint8_t PCF8574LCDFormat::formatFixedPoint(char buffer[], const long& value, const uint8_t& decimals, const uint8_t& width, const char& fill)
+{
+	uint8_t position = maxWidth;
+	const bool negative = value < 0;
+
+	renderDigits(buffer, position, negative ? 0UL - static_cast<unsigned long>(value) : static_cast<unsigned long>(value), decimals > 9 ? 9 : decimals);
+	if (!negative) return fillField(buffer, position, width, fill);
+
+	if (fill == '0')//zeros are placed between sign and digits
+	{
+		while (maxWidth - position + 1 < width && position > 1) buffer[--position] = '0';
+	}
+	buffer[--position] = '-';
+	return fillField(buffer, position, width, fill);
+}
+
+uint8_t PCF8574LCDFormat::formatHex(char buffer[], const unsigned long& value, const uint8_t& digits)
+{
+	const uint8_t length = digits > 8 ? 8 : (digits ? digits : 1);
+	unsigned long rest = value;
+
+	for (uint8_t i = length; i > 0; i--)
+	{
+		uint8_t digit = rest & 0x0F;
+		buffer[i - 1] = digit < 10 ? '0' + digit : 'A' + digit - 10;
+		rest >>= 4;
+	}
+
+	return length;
+}
+
+void PCF8574LCDFormat::renderDigits(char buffer[], uint8_t& position, unsigned long magnitude, const uint8_t& decimals)
+{
+	uint8_t digits = 0;
+
+	do
+	{
+		buffer[--position] = '0' + magnitude % 10;
+		magnitude /= 10;
+		if (++digits == decimals) buffer[--position] = '.';
+	} while (magnitude || digits <= decimals);//at least one digit before decimal point
+}
+
+uint8_t PCF8574LCDFormat::fillField(char buffer[], uint8_t position, const uint8_t& width, const char& fill)
+{
+	const uint8_t fieldWidth = width > maxWidth ? maxWidth : width;
+
+	if (fieldWidth && maxWidth - position > fieldWidth)//number doesn't fit
+	{
+		position = maxWidth - fieldWidth;
+		memset(&buffer[position], '*', fieldWidth);
+	}
+	while (maxWidth - position < fieldWidth) buffer[--position] = fill;
+
+	return position;
+}
@@ -0,0 +1,141 @@
+/*
+ Name:		PCF8574LCDFormat.h
+ Created:	16/10/2026 05:32:54 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDFormat_h
+#define _PCF8574LCDFormat_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+/// <summary>
+/// Formatting of numbers into fields of fixed width, without heap and String. Each field is rendered on stack and written with one call
+/// of write(buffer, size), so display receives it as one burst. Output may be display, frame buffer or any other Print object.
+/// </summary>
+class PCF8574LCDFormat final
+{
+public:
+	/// <summary>
+	/// Maximum width of field, equal to longest line of LCD controller.
+	/// </summary>
+	static const uint8_t maxWidth = 40;
+
+	/// <summary>
+	/// Prints signed number right-aligned in field of given width. If number doesn't fit, field is filled with '*'.
+	/// </summary>
+	/// <param name="output">Display, frame buffer or other Print object</param>
+	/// <param name="value">Number to print</param>
+	/// <param name="width">Width of field, 0 = as many chars as needed</param>
+	/// <param name="fill">Char filling field on the left side. With '0' sign is placed before zeros</param>
+	/// <returns>Number of written chars</returns>
+	template<typename Output>
+	static size_t printNumber(Output& output, const long& value, const uint8_t& width = 0, const char& fill = ' ') { return printFixedPoint(output, value, 0, width, fill); }
+
+	/// <summary>
+	/// Prints unsigned number right-aligned in field of given width. If number doesn't fit, field is filled with '*'.
+	/// </summary>
+	/// <param name="output">Display, frame buffer or other Print object</param>
+	/// <param name="value">Number to print</param>
+	/// <param name="width">Width of field, 0 = as many chars as needed</param>
+	/// <param name="fill">Char filling field on the left side</param>
+	/// <returns>Number of written chars</returns>
+	template<typename Output>
+	static size_t printUnsignedNumber(Output& output, const unsigned long& value, const uint8_t& width = 0, const char& fill = ' ')
+	{
+		char buffer[maxWidth];
+		uint8_t position = formatUnsignedNumber(buffer, value, width, fill);
+		return output.write(reinterpret_cast<const uint8_t*>(&buffer[position]), maxWidth - position);
+	}
+
+	/// <summary>
+	/// Prints fixed-point number right-aligned in field of given width, for example value 12345 with 2 decimals is printed as 123.45.
+	/// If number doesn't fit, field is filled with '*'.
+	/// </summary>
+	/// <param name="output">Display, frame buffer or other Print object</param>
+	/// <param name="value">Number multiplied by 10 to the power of decimals</param>
+	/// <param name="decimals">Number of digits after decimal point (from 0 to 9)</param>
+	/// <param name="width">Width of field, 0 = as many chars as needed</param>
+	/// <param name="fill">Char filling field on the left side. With '0' sign is placed before zeros</param>
+	/// <returns>Number of written chars</returns>
+	template<typename Output>
+	static size_t printFixedPoint(Output& output, const long& value, const uint8_t& decimals, const uint8_t& width = 0, const char& fill = ' ')
+	{
+		char buffer[maxWidth];
+		uint8_t position = formatFixedPoint(buffer, value, decimals, width, fill);
+		return output.write(reinterpret_cast<const uint8_t*>(&buffer[position]), maxWidth - position);
+	}
+
+	/// <summary>
+	/// Prints number as given number of uppercase hexadecimal digits, with leading zeros. Older digits that don't fit are not printed.
+	/// </summary>
+	/// <param name="output">Display, frame buffer or other Print object</param>
+	/// <param name="value">Number to print</param>
+	/// <param name="digits">Number of digits (from 1 to 8)</param>
+	/// <returns>Number of written chars</returns>
+	template<typename Output>
+	static size_t printHex(Output& output, const unsigned long& value, const uint8_t& digits = 2)
+	{
+		char buffer[8];
+		uint8_t length = formatHex(buffer, value, digits);
+		return output.write(reinterpret_cast<const uint8_t*>(buffer), length);
+	}
+
+	/// <summary>
+	/// Renders unsigned number right-aligned in field at the end of buffer.
+	/// </summary>
+	/// <param name="buffer">Buffer of maxWidth chars</param>
+	/// <param name="value">Number to render</param>
+	/// <param name="width">Width of field, 0 = as many chars as needed</param>
+	/// <param name="fill">Char filling field on the left side</param>
+	/// <returns>Position of first char of field in buffer</returns>
+	static uint8_t formatUnsignedNumber(char buffer[], const unsigned long& value, const uint8_t& width, const char& fill);
+
+	/// <summary>
+	/// Renders fixed-point number right-aligned in field at the end of buffer.
+	/// </summary>
+	/// <param name="buffer">Buffer of maxWidth chars</param>
+	/// <param name="value">Number multiplied by 10 to the power of decimals</param>
+	/// <param name="decimals">Number of digits after decimal point (from 0 to 9)</param>
+	/// <param name="width">Width of field, 0 = as many chars as needed</param>
+	/// <param name="fill">Char filling field on the left side. With '0' sign is placed before zeros</param>
+	/// <returns>Position of first char of field in buffer</returns>
+	static uint8_t formatFixedPoint(char buffer[], const long& value, const uint8_t& decimals, const uint8_t& width, const char& fill);
+
+	/// <summary>
+	/// Renders number as given number of uppercase hexadecimal digits at the beginning of buffer.
+	/// </summary>
+	/// <param name="buffer">Buffer of 8 chars</param>
+	/// <param name="value">Number to render</param>
+	/// <param name="digits">Number of digits (from 1 to 8)</param>
+	/// <returns>Number of rendered chars</returns>
+	static uint8_t formatHex(char buffer[], const unsigned long& value, const uint8_t& digits);
+
+private:
+	/// <summary>
+	/// Renders digits of number at given position of buffer, with decimal point placed before given number of last digits.
+	/// </summary>
+	/// <param name="buffer">Buffer of maxWidth chars</param>
+	/// <param name="position">Position after last char to render, moved left by rendering</param>
+	/// <param name="magnitude">Number to render</param>
+	/// <param name="decimals">Number of digits after decimal point</param>
+	static void renderDigits(char buffer[], uint8_t& position, unsigned long magnitude, const uint8_t& decimals);
+
+	/// <summary>
+	/// Fills field on the left side of rendered number, or replaces it with '*' if number doesn't fit.
+	/// </summary>
+	/// <param name="buffer">Buffer of maxWidth chars</param>
+	/// <param name="position">Position of first rendered char</param>
+	/// <param name="width">Width of field, 0 = as many chars as needed</param>
+	/// <param name="fill">Char filling field</param>
+	/// <returns>Position of first char of field in buffer</returns>
+	static uint8_t fillField(char buffer[], uint8_t position, const uint8_t& width, const char& fill);
+};
+
+#endif
@@ -0,0 +1,12 @@
+/*
+ Name:		PCF8574LCDFrameBuffer.cpp
+ Created:	16/10/2026 09:12:05 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDFrameBuffer.h"
+
+template class BasicPCF8574LCDFrameBuffer<PCF8574LCDController>;
+template class BasicPCF8574LCDFrameBuffer<PCF8574BufferedLCDController>;
@@ -0,0 +1,328 @@
+/*
+ Name:		PCF8574LCDFrameBuffer.h
+ Created:	16/10/2026 09:12:05 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDFrameBuffer_h
+#define _PCF8574LCDFrameBuffer_h
+
+#include "PCF8574LCDController.h"
+
+/// <summary>
+/// Frame buffer for given display type.
+/// </summary>
+template<typename Display>
+class BasicPCF8574LCDFrameBuffer final
+{
+public:
+	/// <summary>
+	/// Sets cursor of frame buffer to given position. Display cursor is not moved.
+	/// </summary>
+	/// <param name="x">Char position</param>
+	/// <param name="y">Line</param>
+	void setCursorToPosition(const uint8_t& x, const uint8_t& y) { m_cursorX = x; m_cursorY = y; }
+
+	/// <summary>
+	/// Puts data into frame buffer at cursor position. Data exceeding line is discarded.
+	/// </summary>
+	/// <param name="dataToDisplay">String to display</param>
+	void displayData(const char dataToDisplay[]) { while (*dataToDisplay) { putChar(*dataToDisplay++); } }
+
+	/// <summary>
+	/// Puts given number of chars into frame buffer at cursor position. Chars may include custom char 0.
+	/// </summary>
+	/// <param name="dataToDisplay">Chars to display</param>
+	/// <param name="length">Number of chars</param>
+	void displayData(const char dataToDisplay[], const uint8_t& length) { for (uint8_t i = 0; i < length; i++) { putChar(dataToDisplay[i]); } }
+
+	/// <summary>
+	/// Puts string stored in program memory into frame buffer at cursor position, for example F("text").
+	/// </summary>
+	/// <param name="dataToDisplay">String in program memory</param>
+	void displayData(const __FlashStringHelper* dataToDisplay) { PGM_P data = reinterpret_cast<PGM_P>(dataToDisplay); while (char c = pgm_read_byte(data++)) { putChar(c); } }
+
+	/// <summary>
+	/// Puts given number of chars stored in program memory (PROGMEM) into frame buffer at cursor position. Chars may include custom char 0.
+	/// </summary>
+	/// <param name="dataToDisplay">Chars in program memory</param>
+	/// <param name="length">Number of chars</param>
+	void displayDataFromFlash(const char dataToDisplay[], const uint8_t& length) { for (uint8_t i = 0; i < length; i++) { putChar(pgm_read_byte(&dataToDisplay[i])); } }
+
+	/// <summary>
+	/// Puts char into frame buffer at cursor position.
+	/// </summary>
+	/// <param name="dataToDisplay">Char to display</param>
+	void displayData(const char& dataToDisplay) { putChar(dataToDisplay); }
+
+	/// <summary>
+	/// Puts char into frame buffer at cursor position. Used by PCF8574LCDFormat functions.
+	/// </summary>
+	/// <param name="data">Char to display</param>
+	/// <returns>Number of written chars</returns>
+	size_t write(uint8_t data) { putChar(data); return 1; }
+
+	/// <summary>
+	/// Puts given number of chars into frame buffer at cursor position. Used by PCF8574LCDFormat functions.
+	/// </summary>
+	/// <param name="buffer">Chars to display</param>
+	/// <param name="size">Number of chars</param>
+	/// <returns>Number of written chars</returns>
+	size_t write(const uint8_t* buffer, size_t size) { for (size_t i = 0; i < size; i++) { putChar(buffer[i]); } return size; }
+
+	/// <summary>
+	/// Erases line in frame buffer by writing blanks on whole line. After that it will set cursor to beginning of chosen line.
+	/// </summary>
+	/// <param name="lineNumber">Line to erase</param>
+	void eraseLine(const uint8_t& lineNumber);
+
+	/// <summary>
+	/// Erases all lines in frame buffer. After that it will set cursor to home position.
+	/// </summary>
+	void clear(void) { for (uint8_t i = 0; i < m_displaySizeY; i++) eraseLine(i); setCursorToPosition(0, 0); }
+
+	/// <summary>
+	/// Marks all chars as changed, so next flush will send whole frame buffer. Use it after display content was changed without frame buffer.
+	/// </summary>
+	void invalidate(void);
+
+	/// <summary>
+	/// Checks if frame buffer contains chars not sent to display.
+	/// </summary>
+	/// <returns>True if flush is needed</returns>
+	bool isDirty(void);
+
+	/// <summary>
+	/// Sends only changed chars to display. Adjacent changed chars are sent as one run, so DDRAM address is set only at beginning of each run.
+	/// After flush, display cursor is placed after last sent char.
+	/// </summary>
+	/// <returns>Number of sent chars</returns>
+	uint16_t flush(void) { return flushArea(0, 0, m_displaySizeX, m_displaySizeY); }
+
+	/// <summary>
+	/// Sends changed chars of given rectangular area, line by line, until given number of chars is sent. Chars that didn't fit stay marked as changed,
+	/// so they are sent by next flush. After flush, display cursor is placed after last sent char.
+	/// </summary>
+	/// <param name="x">Char position of left edge of area</param>
+	/// <param name="y">Line of top edge of area</param>
+	/// <param name="width">Number of chars in line of area</param>
+	/// <param name="height">Number of lines of area</param>
+	/// <param name="maxChars">Maximum number of chars to send</param>
+	/// <returns>Number of sent chars</returns>
+	uint16_t flushArea(const uint8_t& x, const uint8_t& y, const uint8_t& width, const uint8_t& height, const uint16_t& maxChars = 0xFFFF);
+
+	/// <summary>
+	/// Checks if given rectangular area contains chars not sent to display.
+	/// </summary>
+	/// <param name="x">Char position of left edge of area</param>
+	/// <param name="y">Line of top edge of area</param>
+	/// <param name="width">Number of chars in line of area</param>
+	/// <param name="height">Number of lines of area</param>
+	/// <returns>True if area needs flush</returns>
+	bool isAreaDirty(const uint8_t& x, const uint8_t& y, const uint8_t& width, const uint8_t& height);
+
+	/// <summary>
+	/// Returns number of chars in line.
+	/// </summary>
+	/// <returns>Chars in line</returns>
+	uint8_t getDisplaySizeX(void) { return m_displaySizeX; }
+
+	/// <summary>
+	/// Returns number of lines.
+	/// </summary>
+	/// <returns>Lines count</returns>
+	uint8_t getDisplaySizeY(void) { return m_displaySizeY; }
+
+	/// <summary>
+	/// Constructor for frame buffer. Frame buffer has size of given display and initially matches cleared display.
+	/// </summary>
+	/// <param name="display">Display that will be updated by flush</param>
+	BasicPCF8574LCDFrameBuffer(Display& display);
+
+	~BasicPCF8574LCDFrameBuffer(void) { delete[] m_cells; delete[] m_dirtyCells; }
+
+	BasicPCF8574LCDFrameBuffer(const BasicPCF8574LCDFrameBuffer&) = delete;
+	BasicPCF8574LCDFrameBuffer& operator=(const BasicPCF8574LCDFrameBuffer&) = delete;
+
+private:
+	/// <summary>
+	/// Display updated by frame buffer.
+	/// </summary>
+	Display& m_display;
+
+	/// <summary>
+	/// Number of chars in line.
+	/// </summary>
+	const uint8_t m_displaySizeX;
+
+	/// <summary>
+	/// Number of lines.
+	/// </summary>
+	const uint8_t m_displaySizeY;
+
+	/// <summary>
+	/// Chars of all lines, one after another.
+	/// </summary>
+	uint8_t* m_cells = nullptr;
+
+	/// <summary>
+	/// One bit for each char, set if char was changed after last flush.
+	/// </summary>
+	uint8_t* m_dirtyCells = nullptr;
+
+	/// <summary>
+	/// Cursor position in line.
+	/// </summary>
+	uint8_t m_cursorX = 0;
+
+	/// <summary>
+	/// Cursor line.
+	/// </summary>
+	uint8_t m_cursorY = 0;
+
+	/// <summary>
+	/// Longest run of unchanged chars that will be sent together with changed chars around it.
+	/// Sending one unchanged char costs as much as setting new DDRAM address, but keeps whole run in one burst.
+	/// </summary>
+	static const uint8_t m_maxGapInRun = 1;
+
+private:
+	/// <summary>
+	/// Puts char at cursor position and moves cursor right. Marks char as changed only if it differs from previous one.
+	/// </summary>
+	/// <param name="data">Char to put</param>
+	void putChar(const char& data);
+
+	/// <summary>
+	/// Checks if char was changed after last flush.
+	/// </summary>
+	/// <param name="index">Index of char in frame buffer</param>
+	/// <returns>True if changed</returns>
+	bool isCellDirty(const uint16_t& index) { return m_dirtyCells[index >> 3] & (1 << (index & 0x07)); }
+
+	/// <summary>
+	/// Marks char as not changed.
+	/// </summary>
+	/// <param name="index">Index of char in frame buffer</param>
+	void clearCellDirty(const uint16_t& index) { m_dirtyCells[index >> 3] &= ~(1 << (index & 0x07)); }
+};
+
+template<typename Display>
+BasicPCF8574LCDFrameBuffer<Display>::BasicPCF8574LCDFrameBuffer(Display& display) :
+	m_display(display), m_displaySizeX(display.getDisplaySizeX()), m_displaySizeY(display.getDisplaySizeY())
+{
+	uint16_t cellsCount = m_displaySizeX * m_displaySizeY;
+
+	m_cells = new uint8_t[cellsCount];
+	m_dirtyCells = new uint8_t[(cellsCount + 7) >> 3];
+	if (m_cells == nullptr || m_dirtyCells == nullptr) return;
+
+	memset(m_cells, ' ', cellsCount);//display is blank after initialization
+	memset(m_dirtyCells, 0, (cellsCount + 7) >> 3);
+}
+
+template<typename Display>
+void BasicPCF8574LCDFrameBuffer<Display>::eraseLine(const uint8_t& lineNumber)
+{
+	setCursorToPosition(0, lineNumber);
+	for (uint8_t i = 0; i < m_displaySizeX; i++) putChar(' ');
+	setCursorToPosition(0, lineNumber);
+}
+
+template<typename Display>
+void BasicPCF8574LCDFrameBuffer<Display>::invalidate(void)
+{
+	if (m_dirtyCells == nullptr) return;
+
+	memset(m_dirtyCells, 0xFF, (m_displaySizeX * m_displaySizeY + 7) >> 3);
+}
+
+template<typename Display>
+bool BasicPCF8574LCDFrameBuffer<Display>::isDirty(void)
+{
+	if (m_dirtyCells == nullptr) return false;
+
+	for (uint16_t i = 0; i < ((m_displaySizeX * m_displaySizeY + 7) >> 3); i++) if (m_dirtyCells[i]) return true;
+	return false;
+}
+
+template<typename Display>
+uint16_t BasicPCF8574LCDFrameBuffer<Display>::flushArea(const uint8_t& x, const uint8_t& y, const uint8_t& width, const uint8_t& height, const uint16_t& maxChars)
+{
+	if (m_cells == nullptr || m_dirtyCells == nullptr) return 0;
+
+	const uint8_t areaEndX = x + width < m_displaySizeX ? x + width : m_displaySizeX;
+	const uint8_t areaEndY = y + height < m_displaySizeY ? y + height : m_displaySizeY;
+	uint16_t sentChars = 0;
+
+	for (uint8_t line = y; line < areaEndY && sentChars < maxChars; line++)
+	{
+		uint16_t lineStart = line * m_displaySizeX;
+		uint8_t position = x;
+
+		while (position < areaEndX && sentChars < maxChars)
+		{
+			if (!isCellDirty(lineStart + position)) { position++; continue; }
+
+			uint8_t runStart = position;
+			uint8_t runEnd = position + 1;//one after last changed char of run
+			for (uint8_t i = runEnd; i < areaEndX && i - runEnd <= m_maxGapInRun; i++)
+			{
+				if (isCellDirty(lineStart + i)) runEnd = i + 1;
+			}
+			if (runEnd - runStart > maxChars - sentChars) runEnd = runStart + (maxChars - sentChars);//rest of run is sent by next flush
+
+			m_display.setCursorToPosition(runStart, line);
+			m_display.displayData(reinterpret_cast<const char*>(&m_cells[lineStart + runStart]), runEnd - runStart);
+			for (uint8_t i = runStart; i < runEnd; i++) clearCellDirty(lineStart + i);
+			sentChars += runEnd - runStart;
+
+			position = runEnd;
+		}
+	}
+
+	if (sentChars) m_display.sendBufferedData();
+	return sentChars;
+}
+
+template<typename Display>
+bool BasicPCF8574LCDFrameBuffer<Display>::isAreaDirty(const uint8_t& x, const uint8_t& y, const uint8_t& width, const uint8_t& height)
+{
+	if (m_dirtyCells == nullptr) return false;
+
+	for (uint8_t line = y; line < y + height && line < m_displaySizeY; line++)
+	{
+		for (uint8_t position = x; position < x + width && position < m_displaySizeX; position++) if (isCellDirty(line * m_displaySizeX + position)) return true;
+	}
+
+	return false;
+}
+
+template<typename Display>
+void BasicPCF8574LCDFrameBuffer<Display>::putChar(const char& data)
+{
+	if (m_cells == nullptr || m_cursorX >= m_displaySizeX || m_cursorY >= m_displaySizeY) return;
+
+	uint16_t index = m_cursorY * m_displaySizeX + m_cursorX++;
+	if (m_cells[index] == static_cast<uint8_t>(data)) return;
+
+	m_cells[index] = data;
+	m_dirtyCells[index >> 3] |= 1 << (index & 0x07);
+}
+
+/// <summary>
+/// Frame buffer for PCF8574LCDController.
+/// </summary>
+typedef BasicPCF8574LCDFrameBuffer<PCF8574LCDController> PCF8574LCDFrameBuffer;
+
+/// <summary>
+/// Frame buffer for PCF8574BufferedLCDController.
+/// </summary>
+typedef BasicPCF8574LCDFrameBuffer<PCF8574BufferedLCDController> PCF8574BufferedLCDFrameBuffer;
+
+extern template class BasicPCF8574LCDFrameBuffer<PCF8574LCDController>;
+extern template class BasicPCF8574LCDFrameBuffer<PCF8574BufferedLCDController>;
+
+#endif
@@ -0,0 +1,155 @@
+/*
+ Name:		PCF8574LCDGeometry.h
+ Created:	16/10/2026 04:48:10 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDGeometry_h
+#define _PCF8574LCDGeometry_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+/// <summary>
+/// Type of LCD controller.
+/// </summary>
+enum class PCF8574LCDDriverType : uint8_t { HD44780, SPLC780D, KS0066 };
+
+//Geometry is a class describing display: getSizeX(), getSizeY(), getFont(), getDriverType(), getLineOffset(line) and getFunctionSet().
+//Controller inherits from geometry chosen by template parameter, so with PCF8574StaticGeometry all values are known at compile time.
+
+/// <summary>
+/// Geometry given to constructor of controller and kept in RAM.
+/// </summary>
+class PCF8574RuntimeGeometry
+{
+public:
+	/// <summary>
+	/// Returns number of chars in line.
+	/// </summary>
+	/// <returns>Chars in line</returns>
+	uint8_t getSizeX(void) const { return m_sizeX; }
+
+	/// <summary>
+	/// Returns number of lines.
+	/// </summary>
+	/// <returns>Lines count</returns>
+	uint8_t getSizeY(void) const { return m_sizeY; }
+
+	/// <summary>
+	/// Returns font type. 0 = 5x8, 1 = 5x10.
+	/// </summary>
+	/// <returns>Font type</returns>
+	uint8_t getFont(void) const { return m_font; }
+
+	/// <summary>
+	/// Returns type of LCD controller.
+	/// </summary>
+	/// <returns>LCD controller type</returns>
+	PCF8574LCDDriverType getDriverType(void) const { return m_driverType; }
+
+	/// <summary>
+	/// Returns DDRAM address of first char in given line.
+	/// </summary>
+	/// <param name="line">Line (from 0 to 3), higher bits are ignored</param>
+	/// <returns>Address in DDRAM</returns>
+	uint8_t getLineOffset(const uint8_t& line) const { return m_lineOffset[line & 0x03]; }
+
+	/// <summary>
+	/// Returns function set for 4bit interface with number of lines and font of this display.
+	/// </summary>
+	/// <returns>Function set command</returns>
+	uint8_t getFunctionSet(void) const { return 0x20 | (m_sizeY > 1 ? 0x08 : 0x00) | (m_font == 1 ? 0x04 : 0x00); }
+
+	/// <summary>
+	/// Constructor for runtime geometry.
+	/// </summary>
+	/// <param name="sizeX">Chars in line</param>
+	/// <param name="sizeY">Lines count, from 1 to 4, higher values are limited to 4</param>
+	/// <param name="font">Font type selection. 0 = 5x8, 1 = 5x10</param>
+	/// <param name="driverType">LCD controller type</param>
+	PCF8574RuntimeGeometry(const uint8_t& sizeX, const uint8_t& sizeY, const uint8_t& font, const PCF8574LCDDriverType& driverType) :
+		m_sizeX(sizeX), m_sizeY(sizeY > 4 ? 4 : sizeY), m_font(font), m_driverType(driverType) {}
+
+private:
+	/// <summary>
+	/// Number of chars in line.
+	/// </summary>
+	const uint8_t m_sizeX;
+
+	/// <summary>
+	/// Number of lines.
+	/// </summary>
+	const uint8_t m_sizeY;
+
+	/// <summary>
+	/// Display font type.
+	/// </summary>
+	const uint8_t m_font;
+
+	/// <summary>
+	/// Type of LCD controller.
+	/// </summary>
+	const PCF8574LCDDriverType m_driverType;
+
+	/// <summary>
+	/// Address offset for each display line.
+	/// </summary>
+	const uint8_t m_lineOffset[4] = { 0x00, 0x40, m_sizeX, static_cast<uint8_t>(0x40 + m_sizeX) };
+};
+
+/// <summary>
+/// Geometry given by template parameters. Takes no RAM and all values, bounds checks and driver choice are resolved at compile time.
+/// </summary>
+template<uint8_t SizeX, uint8_t SizeY, uint8_t Font = 0, PCF8574LCDDriverType DriverType = PCF8574LCDDriverType::HD44780>
+class PCF8574StaticGeometry
+{
+	static_assert(SizeX >= 1 && SizeX <= 40, "Line can't be longer than 40 chars");
+	static_assert(SizeY >= 1 && SizeY <= 4, "Display must have from 1 to 4 lines");
+	static_assert(Font == 0 || Font == 1, "Font must be 0 (5x8) or 1 (5x10)");
+
+public:
+	/// <summary>
+	/// Returns number of chars in line.
+	/// </summary>
+	/// <returns>Chars in line</returns>
+	static constexpr uint8_t getSizeX(void) { return SizeX; }
+
+	/// <summary>
+	/// Returns number of lines.
+	/// </summary>
+	/// <returns>Lines count</returns>
+	static constexpr uint8_t getSizeY(void) { return SizeY; }
+
+	/// <summary>
+	/// Returns font type. 0 = 5x8, 1 = 5x10.
+	/// </summary>
+	/// <returns>Font type</returns>
+	static constexpr uint8_t getFont(void) { return Font; }
+
+	/// <summary>
+	/// Returns type of LCD controller.
+	/// </summary>
+	/// <returns>LCD controller type</returns>
+	static constexpr PCF8574LCDDriverType getDriverType(void) { return DriverType; }
+
+	/// <summary>
+	/// Returns DDRAM address of first char in given line.
+	/// </summary>
+	/// <param name="line">Line (from 0 to 3)</param>
+	/// <returns>Address in DDRAM</returns>
+	static constexpr uint8_t getLineOffset(const uint8_t& line) { return (line & 0x01 ? 0x40 : 0x00) + (line & 0x02 ? SizeX : 0x00); }
+
+	/// <summary>
+	/// Returns function set for 4bit interface with number of lines and font of this display.
+	/// </summary>
+	/// <returns>Function set command</returns>
+	static constexpr uint8_t getFunctionSet(void) { return 0x20 | (SizeY > 1 ? 0x08 : 0x00) | (Font == 1 ? 0x04 : 0x00); }
+};
+
+#endif
@@ -0,0 +1,12 @@
+/*
+ Name:		PCF8574LCDGlyphCache.cpp
+ Created:	16/10/2026 04:05:31 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDGlyphCache.h"
+
+template class BasicPCF8574LCDGlyphCache<PCF8574LCDController>;
+template class BasicPCF8574LCDGlyphCache<PCF8574BufferedLCDController>;
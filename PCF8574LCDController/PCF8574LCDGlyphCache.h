@@ -0,0 +1,265 @@
+/*
+ Name:		PCF8574LCDGlyphCache.h
+ Created:	16/10/2026 04:05:31 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDGlyphCache_h
+#define _PCF8574LCDGlyphCache_h
+
+#include "PCF8574LCDController.h"
+
+/// <summary>
+/// Cache mapping any number of custom chars (glyphs) of application onto CGRAM slots of given display type (8 slots for 5x8 font, 4 for 5x10 font).
+/// Glyph gets slot when acquired and keeps it while it is referenced. Not referenced slots are reused starting from least recently used one.
+/// Copy of CGRAM is kept in RAM, so glyph already present in CGRAM is not uploaded again.
+/// </summary>
+template<typename Display>
+class BasicPCF8574LCDGlyphCache final
+{
+public:
+	/// <summary>
+	/// Value returned by acquire when all slots are referenced.
+	/// </summary>
+	static const uint8_t noChar = 0xFF;
+
+	/// <summary>
+	/// Acquires slot for given glyph and increments its reference count. Each use of glyph on display should be acquired
+	/// and released after it is no longer visible. Glyph data is uploaded by flush.
+	/// </summary>
+	/// <param name="glyph">Glyph data, 8 bytes for 5x8 font or 11 bytes for 5x10 font. Glyph is identified by this pointer</param>
+	/// <returns>Char code to display, or noChar if all slots are referenced</returns>
+	uint8_t acquire(const uint8_t glyph[]);
+
+	/// <summary>
+	/// Decrements reference count of given glyph. Slot of not referenced glyph may be reused, but glyph stays in CGRAM until that happens.
+	/// </summary>
+	/// <param name="glyph">Glyph data given to acquire</param>
+	void release(const uint8_t glyph[]);
+
+	/// <summary>
+	/// Clears reference counts of all glyphs. Use it before redrawing whole screen, when each visible glyph is acquired again.
+	/// </summary>
+	void releaseAll(void) { memset(m_slotReferences, 0, sizeof(m_slotReferences)); }
+
+	/// <summary>
+	/// Uploads glyphs waiting for upload to CGRAM, one burst for each run of consecutive slots. Call it before sending chars using acquired glyphs to display.
+	/// </summary>
+	/// <returns>Number of uploaded glyphs</returns>
+	uint8_t flush(void);
+
+	/// <summary>
+	/// Forgets copy of CGRAM and all slot assignments. Use it after CGRAM was changed without glyph cache.
+	/// </summary>
+	void invalidate(void);
+
+	/// <summary>
+	/// Returns number of CGRAM slots.
+	/// </summary>
+	/// <returns>Number of slots</returns>
+	uint8_t getSlotsCount(void) { return m_slotsCount; }
+
+	/// <summary>
+	/// Constructor for glyph cache. Font of display is read from its function set.
+	/// </summary>
+	/// <param name="display">Display with CGRAM used by glyph cache</param>
+	BasicPCF8574LCDGlyphCache(Display& display);
+
+	BasicPCF8574LCDGlyphCache(const BasicPCF8574LCDGlyphCache&) = delete;
+	BasicPCF8574LCDGlyphCache& operator=(const BasicPCF8574LCDGlyphCache&) = delete;
+
+private:
+	/// <summary>
+	/// Display with CGRAM used by glyph cache.
+	/// </summary>
+	Display& m_display;
+
+	/// <summary>
+	/// Number of CGRAM slots.
+	/// </summary>
+	const uint8_t m_slotsCount;
+
+	/// <summary>
+	/// Number of bytes in glyph.
+	/// </summary>
+	const uint8_t m_glyphSize;
+
+	/// <summary>
+	/// Glyph assigned to each slot.
+	/// </summary>
+	const uint8_t* m_slotGlyphs[8] = {};
+
+	/// <summary>
+	/// Reference count of each slot.
+	/// </summary>
+	uint8_t m_slotReferences[8] = {};
+
+	/// <summary>
+	/// Value of use counter at last acquire of each slot.
+	/// </summary>
+	uint16_t m_slotLastUse[8] = {};
+
+	/// <summary>
+	/// Counter incremented at each acquire, used to find least recently used slot.
+	/// </summary>
+	uint16_t m_useCounter = 0;
+
+	/// <summary>
+	/// Copy of CGRAM.
+	/// </summary>
+	uint8_t m_cgram[64] = {};
+
+	/// <summary>
+	/// One bit for each slot, set if copy of slot matches CGRAM or will match it after flush.
+	/// </summary>
+	uint8_t m_validSlots = 0;
+
+	/// <summary>
+	/// One bit for each slot, set if slot waits for upload.
+	/// </summary>
+	uint8_t m_pendingSlots = 0;
+
+private:
+	/// <summary>
+	/// Returns number of CGRAM bytes used by one slot.
+	/// </summary>
+	/// <returns>Size of slot</returns>
+	uint8_t getSlotSize(void) { return 64 / m_slotsCount; }
+
+	/// <summary>
+	/// Returns char code displaying given slot.
+	/// </summary>
+	/// <param name="slot">Slot number</param>
+	/// <returns>Char code</returns>
+	uint8_t getCharCode(const uint8_t& slot) { return m_slotsCount == 8 ? slot : slot << 1; }
+
+	/// <summary>
+	/// Checks if copy of CGRAM holds given glyph in given slot.
+	/// </summary>
+	/// <param name="slot">Slot number</param>
+	/// <param name="glyph">Glyph data</param>
+	/// <returns>True if slot holds the same data</returns>
+	bool slotHoldsGlyph(const uint8_t& slot, const uint8_t glyph[]) { return (m_validSlots & (1 << slot)) && !memcmp(&m_cgram[slot * getSlotSize()], glyph, m_glyphSize); }
+
+	/// <summary>
+	/// Copies glyph into copy of CGRAM and marks slot for upload.
+	/// </summary>
+	/// <param name="slot">Slot number</param>
+	/// <param name="glyph">Glyph data</param>
+	void storeGlyph(const uint8_t& slot, const uint8_t glyph[]);
+};
+
+template<typename Display>
+BasicPCF8574LCDGlyphCache<Display>::BasicPCF8574LCDGlyphCache(Display& display) :
+	m_display(display), m_slotsCount(display.getCurrentFunctionSet() & 0x04 ? 4 : 8), m_glyphSize(display.getCurrentFunctionSet() & 0x04 ? 11 : 8)
+{
+}
+
+template<typename Display>
+uint8_t BasicPCF8574LCDGlyphCache<Display>::acquire(const uint8_t glyph[])
+{
+	uint8_t chosenSlot = noChar;
+
+	for (uint8_t i = 0; i < m_slotsCount; i++)
+	{
+		if (m_slotGlyphs[i] == glyph) { chosenSlot = i; break; }
+	}
+
+	if (chosenSlot != noChar)//glyph has slot, upload it again only if application changed its data
+	{
+		if (!slotHoldsGlyph(chosenSlot, glyph)) storeGlyph(chosenSlot, glyph);
+	}
+	else
+	{
+		uint16_t oldestAge = 0;
+		for (uint8_t i = 0; i < m_slotsCount; i++)
+		{
+			if (m_slotReferences[i]) continue;
+			if (slotHoldsGlyph(i, glyph)) { chosenSlot = i; break; }//the same data is already in CGRAM, so upload is not needed
+
+			uint16_t age = m_slotGlyphs[i] == nullptr ? 0xFFFF : m_useCounter - m_slotLastUse[i];
+			if (chosenSlot == noChar || age > oldestAge) { chosenSlot = i; oldestAge = age; }
+		}
+
+		if (chosenSlot == noChar) return noChar;
+
+		m_slotGlyphs[chosenSlot] = glyph;
+		if (!slotHoldsGlyph(chosenSlot, glyph)) storeGlyph(chosenSlot, glyph);
+	}
+
+	if (m_slotReferences[chosenSlot] < 0xFF) m_slotReferences[chosenSlot]++;
+	m_slotLastUse[chosenSlot] = ++m_useCounter;
+	return getCharCode(chosenSlot);
+}
+
+template<typename Display>
+void BasicPCF8574LCDGlyphCache<Display>::release(const uint8_t glyph[])
+{
+	for (uint8_t i = 0; i < m_slotsCount; i++)
+	{
+		if (m_slotGlyphs[i] != glyph) continue;
+
+		if (m_slotReferences[i]) m_slotReferences[i]--;
+		return;
+	}
+}
+
+template<typename Display>
+uint8_t BasicPCF8574LCDGlyphCache<Display>::flush(void)
+{
+	if (!m_pendingSlots) return 0;
+
+	uint8_t uploadedGlyphs = 0;
+	for (uint8_t slot = 0; slot < m_slotsCount; slot++)
+	{
+		if (!(m_pendingSlots & (1 << slot))) continue;
+
+		uint8_t lastSlot = slot;
+		while (lastSlot + 1 < m_slotsCount && (m_pendingSlots & (1 << (lastSlot + 1)))) lastSlot++;
+
+		//only runs of pending slots are sent, so glyphs uploaded outside of cache stay intact
+		m_display.writeDataToCGRAM(slot * getSlotSize(), &m_cgram[slot * getSlotSize()], (lastSlot - slot) * getSlotSize() + m_glyphSize);
+		uploadedGlyphs += lastSlot - slot + 1;
+		slot = lastSlot;
+	}
+
+	m_display.sendBufferedData();
+	m_pendingSlots = 0;
+	return uploadedGlyphs;
+}
+
+template<typename Display>
+void BasicPCF8574LCDGlyphCache<Display>::invalidate(void)
+{
+	memset(m_slotGlyphs, 0, sizeof(m_slotGlyphs));
+	memset(m_slotReferences, 0, sizeof(m_slotReferences));
+	m_validSlots = 0;
+	m_pendingSlots = 0;
+}
+
+template<typename Display>
+void BasicPCF8574LCDGlyphCache<Display>::storeGlyph(const uint8_t& slot, const uint8_t glyph[])
+{
+	memset(&m_cgram[slot * getSlotSize()], 0, getSlotSize());
+	memcpy(&m_cgram[slot * getSlotSize()], glyph, m_glyphSize);
+
+	m_validSlots |= 1 << slot;
+	m_pendingSlots |= 1 << slot;
+}
+
+/// <summary>
+/// Glyph cache for PCF8574LCDController.
+/// </summary>
+typedef BasicPCF8574LCDGlyphCache<PCF8574LCDController> PCF8574LCDGlyphCache;
+
+/// <summary>
+/// Glyph cache for PCF8574BufferedLCDController.
+/// </summary>
+typedef BasicPCF8574LCDGlyphCache<PCF8574BufferedLCDController> PCF8574BufferedLCDGlyphCache;
+
+extern template class BasicPCF8574LCDGlyphCache<PCF8574LCDController>;
+extern template class BasicPCF8574LCDGlyphCache<PCF8574BufferedLCDController>;
+
+#endif
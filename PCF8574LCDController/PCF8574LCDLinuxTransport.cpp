@@ -0,0 +1,114 @@
+/*
+ Name:		PCF8574LCDLinuxTransport.cpp
+ Created:	17/10/2026 12:58:44 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDLinuxTransport.h"
+
+#if defined(__linux__)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+bool PCF8574LinuxI2cBus::open(const char devicePath[])
+{
+	close();
+
+	m_file = ::open(devicePath, O_RDWR);
+	return m_file >= 0;
+}
+
+void PCF8574LinuxI2cBus::openFakeDevice(PCF8574LCDEmulator& device)
+{
+	close();
+
+	m_fakeDevice = &device;
+}
+
+void PCF8574LinuxI2cBus::close(void)
+{
+	submit();
+
+	if (m_file >= 0) ::close(m_file);
+	m_file = -1;
+	m_fakeDevice = nullptr;
+}
+
+void PCF8574LinuxI2cBus::beginTransmission(const uint8_t& address)
+{
+	if (m_messagesCount == I2C_RDWR_IOCTL_MAX_MSGS - 1 || m_dataLength > sizeof(m_data) - PCF8574_LCD_LINUX_MESSAGE_LENGTH) submit();//last message is left for read
+
+	i2c_msg& message = m_messages[m_messagesCount++];
+	message.addr = address;
+	message.flags = 0;
+	message.len = 0;
+	message.buf = &m_data[m_dataLength];
+	m_messageOpen = true;
+}
+
+void PCF8574LinuxI2cBus::write(const uint8_t& data)
+{
+	if (!m_messageOpen || m_messages[m_messagesCount - 1].len == PCF8574_LCD_LINUX_MESSAGE_LENGTH) return;
+
+	m_data[m_dataLength++] = data;
+	m_messages[m_messagesCount - 1].len++;
+}
+
+bool PCF8574LinuxI2cBus::read(const uint8_t& address, uint8_t& data)
+{
+	i2c_msg& message = m_messages[m_messagesCount++];
+	message.addr = address;
+	message.flags = I2C_M_RD;
+	message.len = 1;
+	message.buf = &data;
+	m_messageOpen = false;
+
+	return submit();
+}
+
+bool PCF8574LinuxI2cBus::submit(void)
+{
+	if (!m_messagesCount) return true;
+
+	bool sent = false;
+	if (m_fakeDevice != nullptr) sent = transferToFakeDevice();
+	else if (m_file >= 0)
+	{
+		i2c_rdwr_ioctl_data batch = { m_messages, m_messagesCount };
+		sent = ioctl(m_file, I2C_RDWR, &batch) >= 0;
+	}
+
+	m_systemCallsCount++;
+	if (!sent) m_failedSystemCallsCount++;
+
+	m_messagesCount = 0;
+	m_dataLength = 0;
+	m_messageOpen = false;
+	return sent;
+}
+
+bool PCF8574LinuxI2cBus::transferToFakeDevice(void)
+{
+	for (uint8_t i = 0; i < m_messagesCount; i++)
+	{
+		const i2c_msg& message = m_messages[i];
+
+		if (message.flags & I2C_M_RD)
+		{
+			if (!m_fakeDevice->read(message.addr, message.buf[0])) return false;//no acknowledge, rest of batch is not sent
+			continue;
+		}
+
+		m_fakeDevice->beginTransmission(message.addr);
+		for (uint16_t j = 0; j < message.len; j++) m_fakeDevice->write(message.buf[j]);
+		m_fakeDevice->endTransmission();
+	}
+
+	return true;
+}
+
+#endif // __linux__
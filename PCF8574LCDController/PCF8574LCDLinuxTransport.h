@@ -0,0 +1,224 @@
+/*
+ Name:		PCF8574LCDLinuxTransport.h
+ Created:	17/10/2026 12:58:44 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDLinuxTransport_h
+#define _PCF8574LCDLinuxTransport_h
+
+#if defined(__linux__)
+
+#include "PCF8574LCDEmulator.h"
+
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#ifndef PCF8574_LCD_LINUX_MESSAGE_LENGTH
+#define PCF8574_LCD_LINUX_MESSAGE_LENGTH 128
+#endif
+
+#ifndef PCF8574_LCD_LINUX_BATCH_LENGTH
+#define PCF8574_LCD_LINUX_BATCH_LENGTH 1024
+#endif
+
+/// <summary>
+/// I2C bus of Linux (/dev/i2c-N) for transport of controller on single board computers. Each transmission is one I2C message,
+/// and messages are collected into batch submitted by one I2C_RDWR ioctl, so strobe sequences and strings need one system call,
+/// instead of one for each transmission. Batch is submitted when it is full, when byte is read (read is the last message of batch) or on flush.
+/// Instead of device file, emulator may be attached as fake device, so transport can be tested and measured without hardware.
+/// </summary>
+class PCF8574LinuxI2cBus final
+{
+public:
+	/// <summary>
+	/// Opens I2C bus device file.
+	/// </summary>
+	/// <param name="devicePath">Path of device file, like "/dev/i2c-1"</param>
+	/// <returns>True if device was opened</returns>
+	bool open(const char devicePath[]);
+
+	/// <summary>
+	/// Attaches emulator as fake device receiving all messages, instead of device file.
+	/// </summary>
+	/// <param name="device">Emulator of PCF8574 with LCD controller</param>
+	void openFakeDevice(PCF8574LCDEmulator& device);
+
+	/// <summary>
+	/// Submits collected messages and closes device file or detaches fake device.
+	/// </summary>
+	void close(void);
+
+	/// <summary>
+	/// Starts message to given device. Batch is submitted first, if there is no space for message.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	void beginTransmission(const uint8_t& address);
+
+	/// <summary>
+	/// Adds byte to current message.
+	/// </summary>
+	/// <param name="data">Byte to send</param>
+	void write(const uint8_t& data);
+
+	/// <summary>
+	/// Ends current message. In batching mode it is submitted with batch, otherwise immediately.
+	/// </summary>
+	void endTransmission(void) { m_messageOpen = false; if (!m_batching) flush(); }
+
+	/// <summary>
+	/// Reads one byte from given device. Collected messages are submitted together with read, by one system call.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	/// <param name="data">Readed byte</param>
+	/// <returns>True if byte was readed</returns>
+	bool read(const uint8_t& address, uint8_t& data);
+
+	/// <summary>
+	/// Submits collected messages.
+	/// </summary>
+	/// <returns>True if messages were sent</returns>
+	bool flush(void) { return submit(); }
+
+	/// <summary>
+	/// Enables or disables batching. Without batching each transmission and each read is one system call, as with direct mapping of Wire.
+	/// </summary>
+	/// <param name="batching">True to collect messages into batches</param>
+	void setBatching(const bool& batching) { flush(); m_batching = batching; }
+
+	/// <summary>
+	/// Returns number of I2C_RDWR system calls (or transfers to fake device).
+	/// </summary>
+	/// <returns>Number of system calls</returns>
+	unsigned long getSystemCallsCount(void) { return m_systemCallsCount; }
+
+	/// <summary>
+	/// Returns number of system calls that failed.
+	/// </summary>
+	/// <returns>Number of failed system calls</returns>
+	unsigned long getFailedSystemCallsCount(void) { return m_failedSystemCallsCount; }
+
+	/// <summary>
+	/// Clears counters of system calls.
+	/// </summary>
+	void resetCounters(void) { m_systemCallsCount = 0; m_failedSystemCallsCount = 0; }
+
+	PCF8574LinuxI2cBus(void) {}
+	~PCF8574LinuxI2cBus(void) { close(); }
+
+	PCF8574LinuxI2cBus(const PCF8574LinuxI2cBus&) = delete;
+	PCF8574LinuxI2cBus& operator=(const PCF8574LinuxI2cBus&) = delete;
+
+private:
+	/// <summary>
+	/// Descriptor of device file, -1 if it is not opened.
+	/// </summary>
+	int m_file = -1;
+
+	/// <summary>
+	/// Emulator attached as fake device, nullptr if device file is used.
+	/// </summary>
+	PCF8574LCDEmulator* m_fakeDevice = nullptr;
+
+	/// <summary>
+	/// Messages of batch.
+	/// </summary>
+	i2c_msg m_messages[I2C_RDWR_IOCTL_MAX_MSGS];
+
+	/// <summary>
+	/// Number of messages in batch.
+	/// </summary>
+	uint8_t m_messagesCount = 0;
+
+	/// <summary>
+	/// Bytes of all messages in batch.
+	/// </summary>
+	uint8_t m_data[PCF8574_LCD_LINUX_BATCH_LENGTH];
+
+	/// <summary>
+	/// Number of bytes in batch.
+	/// </summary>
+	uint16_t m_dataLength = 0;
+
+	/// <summary>
+	/// True if bytes are added to last message.
+	/// </summary>
+	bool m_messageOpen = false;
+
+	/// <summary>
+	/// State of batching.
+	/// </summary>
+	bool m_batching = true;
+
+	/// <summary>
+	/// Number of system calls.
+	/// </summary>
+	unsigned long m_systemCallsCount = 0;
+
+	/// <summary>
+	/// Number of failed system calls.
+	/// </summary>
+	unsigned long m_failedSystemCallsCount = 0;
+
+private:
+	/// <summary>
+	/// Submits messages of batch by one system call.
+	/// </summary>
+	/// <returns>True if messages were sent</returns>
+	bool submit(void);
+
+	/// <summary>
+	/// Delivers messages of batch to fake device.
+	/// </summary>
+	/// <returns>True if all messages were accepted</returns>
+	bool transferToFakeDevice(void);
+};
+
+/// <summary>
+/// Transport sending transmissions through given I2C bus of Linux.
+/// </summary>
+template<PCF8574LinuxI2cBus& Bus>
+class PCF8574LinuxI2cTransport final
+{
+public:
+	/// <summary>
+	/// Maximum number of bytes in one transmission.
+	/// </summary>
+	static const uint8_t bufferLength = PCF8574_LCD_LINUX_MESSAGE_LENGTH;
+
+	/// <summary>
+	/// Starts transmission to given device.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	static void beginTransmission(const uint8_t& address) { Bus.beginTransmission(address); }
+
+	/// <summary>
+	/// Adds byte to current transmission.
+	/// </summary>
+	/// <param name="data">Byte to send</param>
+	static void write(const uint8_t& data) { Bus.write(data); }
+
+	/// <summary>
+	/// Ends current transmission, which is sent with batch.
+	/// </summary>
+	static void endTransmission(void) { Bus.endTransmission(); }
+
+	/// <summary>
+	/// Reads one byte from given device, together with collected transmissions.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	/// <param name="data">Readed byte</param>
+	/// <returns>True if byte was readed</returns>
+	static bool read(const uint8_t& address, uint8_t& data) { return Bus.read(address, data); }
+
+	/// <summary>
+	/// Sends collected transmissions.
+	/// </summary>
+	static void flush(void) { Bus.flush(); }
+};
+
+#endif // __linux__
+
+#endif
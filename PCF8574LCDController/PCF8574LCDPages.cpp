@@ -0,0 +1,12 @@
+/*
+ Name:		PCF8574LCDPages.cpp
+ Created:	16/10/2026 11:48:31 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDPages.h"
+
+template class BasicPCF8574LCDPages<PCF8574LCDController>;
+template class BasicPCF8574LCDPages<PCF8574BufferedLCDController>;
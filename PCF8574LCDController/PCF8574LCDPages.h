@@ -0,0 +1,232 @@
+/*
+ Name:		PCF8574LCDPages.h
+ Created:	16/10/2026 11:48:31 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDPages_h
+#define _PCF8574LCDPages_h
+
+#include "PCF8574LCDController.h"
+
+/// <summary>
+/// Pages of screen kept side by side in DDRAM line (40 chars in two line mode, 80 in one line mode), on given display type.
+/// One page is shown, while next one is drawn into DDRAM columns outside of view, and it is shown at once by display shift commands
+/// sent in one burst, so partially drawn screen is never visible. Pages that were drawn before are shown again without sending their content.
+/// Page switching uses display shift, so it can't be used with ticker. On four line displays lines 2 and 3 continue lines 0 and 1,
+/// so there is space for one page only, unless lines are short.
+/// Pages object may be used as display by frame buffer, big digits and bar graphs, which then draw on page chosen by setDrawPage.
+/// </summary>
+template<typename Display>
+class BasicPCF8574LCDPages final
+{
+public:
+	/// <summary>
+	/// Returns number of pages fitting in DDRAM line.
+	/// </summary>
+	/// <returns>Number of pages</returns>
+	uint8_t getPagesCount(void) { return m_pagesCount; }
+
+	/// <summary>
+	/// Chooses page on which chars are drawn. It may be shown or not.
+	/// </summary>
+	/// <param name="page">Page (from 0 to number of pages - 1)</param>
+	void setDrawPage(const uint8_t& page) { if (page < m_pagesCount) m_drawPage = page; }
+
+	/// <summary>
+	/// Returns page on which chars are drawn.
+	/// </summary>
+	/// <returns>Page</returns>
+	uint8_t getDrawPage(void) { return m_drawPage; }
+
+	/// <summary>
+	/// Returns shown page.
+	/// </summary>
+	/// <returns>Page</returns>
+	uint8_t getShownPage(void) { return m_shownPage; }
+
+	/// <summary>
+	/// Shows given page by the shortest display shift. All shift commands are sent in one burst.
+	/// </summary>
+	/// <param name="page">Page (from 0 to number of pages - 1)</param>
+	void showPage(const uint8_t& page);
+
+	/// <summary>
+	/// Shows drawn page, and chooses page shown until now for drawing, as in double buffering.
+	/// </summary>
+	void flip(void) { uint8_t page = m_shownPage; showPage(m_drawPage); m_drawPage = page; }
+
+	/// <summary>
+	/// Fills drawn page with blanks.
+	/// </summary>
+	void clearPage(void);
+
+	/// <summary>
+	/// Forgets display shift. Use it after clear display or return home, which cancel display shift and show page 0.
+	/// </summary>
+	void invalidate(void) { m_shownPage = 0; m_viewColumn = 0; }
+
+	/// <summary>
+	/// Sets cursor to given position of drawn page.
+	/// </summary>
+	/// <param name="x">Char position</param>
+	/// <param name="y">Line</param>
+	void setCursorToPosition(const uint8_t& x, const uint8_t& y) { m_display.setCursorToPosition(m_drawPage * m_pageStride + x, y); }
+
+	/// <summary>
+	/// Displays string from given position of cursor on drawn page.
+	/// </summary>
+	/// <param name="dataToDisplay">String to display</param>
+	void displayData(const char dataToDisplay[]) { m_display.displayData(dataToDisplay); }
+
+	/// <summary>
+	/// Displays chars from given position of cursor on drawn page.
+	/// </summary>
+	/// <param name="dataToDisplay">Chars to display</param>
+	/// <param name="length">Number of chars</param>
+	void displayData(const char dataToDisplay[], const uint8_t& length) { m_display.displayData(dataToDisplay, length); }
+
+	/// <summary>
+	/// Displays string stored in program memory from given position of cursor on drawn page, for example F("text").
+	/// </summary>
+	/// <param name="dataToDisplay">String in program memory</param>
+	void displayData(const __FlashStringHelper* dataToDisplay) { m_display.displayData(dataToDisplay); }
+
+	/// <summary>
+	/// Displays chars stored in program memory (PROGMEM) from given position of cursor on drawn page.
+	/// </summary>
+	/// <param name="dataToDisplay">Chars in program memory</param>
+	/// <param name="length">Number of chars</param>
+	void displayDataFromFlash(const char dataToDisplay[], const uint8_t& length) { m_display.displayDataFromFlash(dataToDisplay, length); }
+
+	/// <summary>
+	/// Displays char from given position of cursor on drawn page.
+	/// </summary>
+	/// <param name="dataToDisplay">Char to display</param>
+	void displayData(const char& dataToDisplay) { m_display.displayData(dataToDisplay); }
+
+	/// <summary>
+	/// Writes data to CGRAM, which is shared by all pages.
+	/// </summary>
+	/// <param name="address">Address in CGRAM</param>
+	/// <param name="data">Bytes to write</param>
+	/// <param name="length">Number of bytes</param>
+	void writeDataToCGRAM(const uint8_t& address, const uint8_t data[], const uint8_t& length) { m_display.writeDataToCGRAM(address, data, length); }
+
+	/// <summary>
+	/// Sends data deferred by transport of display.
+	/// </summary>
+	void sendBufferedData(void) { m_display.sendBufferedData(); }
+
+	/// <summary>
+	/// Returns number of chars in line of page.
+	/// </summary>
+	/// <returns>Chars in line</returns>
+	uint8_t getDisplaySizeX(void) { return m_display.getDisplaySizeX(); }
+
+	/// <summary>
+	/// Returns number of lines of page.
+	/// </summary>
+	/// <returns>Lines count</returns>
+	uint8_t getDisplaySizeY(void) { return m_display.getDisplaySizeY(); }
+
+	/// <summary>
+	/// Constructor for pages. Nothing is sent to display, it must not be shifted, as after initialization. Page 0 is shown and page 1 is drawn.
+	/// </summary>
+	/// <param name="display">Display showing pages</param>
+	BasicPCF8574LCDPages(Display& display);
+
+	BasicPCF8574LCDPages(const BasicPCF8574LCDPages&) = delete;
+	BasicPCF8574LCDPages& operator=(const BasicPCF8574LCDPages&) = delete;
+
+private:
+	/// <summary>
+	/// Display showing pages.
+	/// </summary>
+	Display& m_display;
+
+	/// <summary>
+	/// Number of chars in DDRAM line, 40 in two line mode and 80 in one line mode.
+	/// </summary>
+	const uint8_t m_rowLength;
+
+	/// <summary>
+	/// Number of DDRAM columns taken by page, twice the line length on four line displays.
+	/// </summary>
+	const uint8_t m_pageStride;
+
+	/// <summary>
+	/// Number of pages fitting in DDRAM line.
+	/// </summary>
+	const uint8_t m_pagesCount;
+
+	/// <summary>
+	/// Page on which chars are drawn.
+	/// </summary>
+	uint8_t m_drawPage;
+
+	/// <summary>
+	/// Shown page.
+	/// </summary>
+	uint8_t m_shownPage = 0;
+
+	/// <summary>
+	/// DDRAM column shown at the beginning of view.
+	/// </summary>
+	uint8_t m_viewColumn = 0;
+};
+
+template<typename Display>
+BasicPCF8574LCDPages<Display>::BasicPCF8574LCDPages(Display& display) :
+	m_display(display), m_rowLength(display.getCurrentFunctionSet() & 0x08 ? 40 : 80), m_pageStride(display.getDisplaySizeX() * (display.getDisplaySizeY() > 2 ? 2 : 1)),
+	m_pagesCount(m_pageStride < m_rowLength ? m_rowLength / m_pageStride : 1), m_drawPage(m_pagesCount > 1 ? 1 : 0)
+{
+}
+
+template<typename Display>
+void BasicPCF8574LCDPages<Display>::showPage(const uint8_t& page)
+{
+	if (page >= m_pagesCount || page == m_shownPage) return;
+
+	const uint8_t column = page * m_pageStride;
+	const uint8_t leftShifts = (column + m_rowLength - m_viewColumn) % m_rowLength;//shift to left moves view to higher columns
+
+	if (leftShifts <= m_rowLength - leftShifts) m_display.shiftDisplayToLeft(leftShifts);
+	else m_display.shiftDisplayToRight(m_rowLength - leftShifts);
+	m_display.sendBufferedData();
+
+	m_viewColumn = column;
+	m_shownPage = page;
+}
+
+template<typename Display>
+void BasicPCF8574LCDPages<Display>::clearPage(void)
+{
+	char blanks[40];
+	memset(blanks, ' ', sizeof(blanks));
+
+	for (uint8_t line = 0; line < getDisplaySizeY(); line++)
+	{
+		setCursorToPosition(0, line);
+		displayData(blanks, getDisplaySizeX() > sizeof(blanks) ? sizeof(blanks) : getDisplaySizeX());
+	}
+
+	m_display.sendBufferedData();
+}
+
+/// <summary>
+/// Pages for PCF8574LCDController.
+/// </summary>
+typedef BasicPCF8574LCDPages<PCF8574LCDController> PCF8574LCDPages;
+
+/// <summary>
+/// Pages for PCF8574BufferedLCDController.
+/// </summary>
+typedef BasicPCF8574LCDPages<PCF8574BufferedLCDController> PCF8574BufferedLCDPages;
+
+extern template class BasicPCF8574LCDPages<PCF8574LCDController>;
+extern template class BasicPCF8574LCDPages<PCF8574BufferedLCDController>;
+
+#endif
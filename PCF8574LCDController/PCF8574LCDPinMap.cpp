@@ -0,0 +1,15 @@
+/*
+ Name:		PCF8574LCDPinMap.cpp
+ Created:	17/10/2026 03:41:26 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDPinMap.h"
+
+const uint8_t PCF8574LCDStandardPinMap::registerSelect;
+const uint8_t PCF8574LCDStandardPinMap::readWrite;
+const uint8_t PCF8574LCDStandardPinMap::enable;
+const uint8_t PCF8574LCDStandardPinMap::backlight;
+const uint8_t PCF8574LCDStandardPinMap::dataLines;
@@ -0,0 +1,184 @@
+/*
+ Name:		PCF8574LCDPinMap.h
+ Created:	17/10/2026 03:41:26 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDPinMap_h
+#define _PCF8574LCDPinMap_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#define PCF8574_LCD_ENABLE_LINE 0x04
+
+//Pin map is a class describing wiring of port expander to LCD: masks of pins registerSelect, readWrite (0 if R/W line is tied low), enable, backlight
+//and dataLines (D4-D7), getUpperNibble(data) and getLowerNibble(data) returning states of data pins for nibble of byte, and getNibble(portState)
+//returning nibble placed on data pins. Pin map is chosen by template parameter of controller, so masks are constants and nibbles are transformed
+//without run time decisions.
+
+/// <summary>
+/// Wiring of most PCF8574 backpacks: P0 = RS, P1 = R/W, P2 = E, P3 = backlight, P4-P7 = D4-D7. Nibbles are moved to data pins by shifts.
+/// </summary>
+class PCF8574LCDStandardPinMap final
+{
+public:
+	/// <summary>
+	/// Mask of pin connected to RS line.
+	/// </summary>
+	static const uint8_t registerSelect = 0x01;
+
+	/// <summary>
+	/// Mask of pin connected to R/W line, 0 if R/W line is tied low.
+	/// </summary>
+	static const uint8_t readWrite = 0x02;
+
+	/// <summary>
+	/// Mask of pin connected to E line.
+	/// </summary>
+	static const uint8_t enable = PCF8574_LCD_ENABLE_LINE;
+
+	/// <summary>
+	/// Mask of pin switching backlight.
+	/// </summary>
+	static const uint8_t backlight = 0x08;
+
+	/// <summary>
+	/// Mask of pins connected to D4-D7 lines.
+	/// </summary>
+	static const uint8_t dataLines = 0xF0;
+
+	/// <summary>
+	/// Returns states of data pins for upper nibble of given byte.
+	/// </summary>
+	/// <param name="data">Byte to send</param>
+	/// <returns>States of data pins</returns>
+	static uint8_t getUpperNibble(const uint8_t& data) { return data & 0xF0; }
+
+	/// <summary>
+	/// Returns states of data pins for lower nibble of given byte.
+	/// </summary>
+	/// <param name="data">Byte to send</param>
+	/// <returns>States of data pins</returns>
+	static uint8_t getLowerNibble(const uint8_t& data) { return static_cast<uint8_t>(data << 4); }
+
+	/// <summary>
+	/// Returns nibble placed on data pins.
+	/// </summary>
+	/// <param name="portState">State of port</param>
+	/// <returns>Nibble (from 0x00 to 0x0F)</returns>
+	static uint8_t getNibble(const uint8_t& portState) { return portState >> 4; }
+};
+
+/// <summary>
+/// Returns states of given data pins for given nibble. Used for tables of PCF8574LCDPinMap.
+/// </summary>
+/// <param name="nibble">Nibble (from 0x00 to 0x0F)</param>
+/// <param name="d4">Mask of pin connected to D4 line</param>
+/// <param name="d5">Mask of pin connected to D5 line</param>
+/// <param name="d6">Mask of pin connected to D6 line</param>
+/// <param name="d7">Mask of pin connected to D7 line</param>
+/// <returns>States of data pins</returns>
+constexpr uint8_t mapPCF8574LCDNibble(const uint8_t nibble, const uint8_t d4, const uint8_t d5, const uint8_t d6, const uint8_t d7)
+{
+	return (nibble & 0x01 ? d4 : 0x00) | (nibble & 0x02 ? d5 : 0x00) | (nibble & 0x04 ? d6 : 0x00) | (nibble & 0x08 ? d7 : 0x00);
+}
+
+/// <summary>
+/// Wiring given by masks of pins connected to each line, for backpacks of other vendors and other port expanders.
+/// States of data pins for all nibbles are computed at compile time into table of 16 bytes, so any order of data pins costs one table read per nibble.
+/// </summary>
+template<uint8_t RegisterSelect, uint8_t ReadWrite, uint8_t Enable, uint8_t Backlight, uint8_t D4, uint8_t D5, uint8_t D6, uint8_t D7>
+class PCF8574LCDPinMap final
+{
+	static_assert(!((RegisterSelect | ReadWrite | Enable | Backlight) & (D4 | D5 | D6 | D7)), "Control lines and data lines of pin map must use different pins");
+
+public:
+	/// <summary>
+	/// Mask of pin connected to RS line.
+	/// </summary>
+	static const uint8_t registerSelect = RegisterSelect;
+
+	/// <summary>
+	/// Mask of pin connected to R/W line, 0 if R/W line is tied low.
+	/// </summary>
+	static const uint8_t readWrite = ReadWrite;
+
+	/// <summary>
+	/// Mask of pin connected to E line.
+	/// </summary>
+	static const uint8_t enable = Enable;
+
+	/// <summary>
+	/// Mask of pin switching backlight.
+	/// </summary>
+	static const uint8_t backlight = Backlight;
+
+	/// <summary>
+	/// Mask of pins connected to D4-D7 lines.
+	/// </summary>
+	static const uint8_t dataLines = D4 | D5 | D6 | D7;
+
+	/// <summary>
+	/// Returns states of data pins for upper nibble of given byte.
+	/// </summary>
+	/// <param name="data">Byte to send</param>
+	/// <returns>States of data pins</returns>
+	static uint8_t getUpperNibble(const uint8_t& data) { return m_nibbleStates[data >> 4]; }
+
+	/// <summary>
+	/// Returns states of data pins for lower nibble of given byte.
+	/// </summary>
+	/// <param name="data">Byte to send</param>
+	/// <returns>States of data pins</returns>
+	static uint8_t getLowerNibble(const uint8_t& data) { return m_nibbleStates[data & 0x0F]; }
+
+	/// <summary>
+	/// Returns nibble placed on data pins.
+	/// </summary>
+	/// <param name="portState">State of port</param>
+	/// <returns>Nibble (from 0x00 to 0x0F)</returns>
+	static uint8_t getNibble(const uint8_t& portState) { return (portState & D4 ? 0x01 : 0x00) | (portState & D5 ? 0x02 : 0x00) | (portState & D6 ? 0x04 : 0x00) | (portState & D7 ? 0x08 : 0x00); }
+
+private:
+	/// <summary>
+	/// States of data pins for each nibble.
+	/// </summary>
+	static constexpr uint8_t m_nibbleStates[16] = {
+		mapPCF8574LCDNibble(0x00, D4, D5, D6, D7), mapPCF8574LCDNibble(0x01, D4, D5, D6, D7), mapPCF8574LCDNibble(0x02, D4, D5, D6, D7), mapPCF8574LCDNibble(0x03, D4, D5, D6, D7),
+		mapPCF8574LCDNibble(0x04, D4, D5, D6, D7), mapPCF8574LCDNibble(0x05, D4, D5, D6, D7), mapPCF8574LCDNibble(0x06, D4, D5, D6, D7), mapPCF8574LCDNibble(0x07, D4, D5, D6, D7),
+		mapPCF8574LCDNibble(0x08, D4, D5, D6, D7), mapPCF8574LCDNibble(0x09, D4, D5, D6, D7), mapPCF8574LCDNibble(0x0A, D4, D5, D6, D7), mapPCF8574LCDNibble(0x0B, D4, D5, D6, D7),
+		mapPCF8574LCDNibble(0x0C, D4, D5, D6, D7), mapPCF8574LCDNibble(0x0D, D4, D5, D6, D7), mapPCF8574LCDNibble(0x0E, D4, D5, D6, D7), mapPCF8574LCDNibble(0x0F, D4, D5, D6, D7)
+	};
+};
+
+template<uint8_t RegisterSelect, uint8_t ReadWrite, uint8_t Enable, uint8_t Backlight, uint8_t D4, uint8_t D5, uint8_t D6, uint8_t D7>
+const uint8_t PCF8574LCDPinMap<RegisterSelect, ReadWrite, Enable, Backlight, D4, D5, D6, D7>::registerSelect;
+
+template<uint8_t RegisterSelect, uint8_t ReadWrite, uint8_t Enable, uint8_t Backlight, uint8_t D4, uint8_t D5, uint8_t D6, uint8_t D7>
+const uint8_t PCF8574LCDPinMap<RegisterSelect, ReadWrite, Enable, Backlight, D4, D5, D6, D7>::readWrite;
+
+template<uint8_t RegisterSelect, uint8_t ReadWrite, uint8_t Enable, uint8_t Backlight, uint8_t D4, uint8_t D5, uint8_t D6, uint8_t D7>
+const uint8_t PCF8574LCDPinMap<RegisterSelect, ReadWrite, Enable, Backlight, D4, D5, D6, D7>::enable;
+
+template<uint8_t RegisterSelect, uint8_t ReadWrite, uint8_t Enable, uint8_t Backlight, uint8_t D4, uint8_t D5, uint8_t D6, uint8_t D7>
+const uint8_t PCF8574LCDPinMap<RegisterSelect, ReadWrite, Enable, Backlight, D4, D5, D6, D7>::backlight;
+
+template<uint8_t RegisterSelect, uint8_t ReadWrite, uint8_t Enable, uint8_t Backlight, uint8_t D4, uint8_t D5, uint8_t D6, uint8_t D7>
+const uint8_t PCF8574LCDPinMap<RegisterSelect, ReadWrite, Enable, Backlight, D4, D5, D6, D7>::dataLines;
+
+template<uint8_t RegisterSelect, uint8_t ReadWrite, uint8_t Enable, uint8_t Backlight, uint8_t D4, uint8_t D5, uint8_t D6, uint8_t D7>
+constexpr uint8_t PCF8574LCDPinMap<RegisterSelect, ReadWrite, Enable, Backlight, D4, D5, D6, D7>::m_nibbleStates[16];
+
+/// <summary>
+/// Wiring of MCP23008 backpacks (like Adafruit I2C/SPI LCD backpack): GP1 = RS, GP2 = E, GP3-GP6 = D4-D7, GP7 = backlight, R/W line tied low.
+/// Use it with MCP23008WireTransport and Timed mode.
+/// </summary>
+typedef PCF8574LCDPinMap<0x02, 0x00, 0x04, 0x80, 0x08, 0x10, 0x20, 0x40> PCF8574LCDMCP23008PinMap;
+
+#endif
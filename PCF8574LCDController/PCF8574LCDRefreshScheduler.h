@@ -0,0 +1,215 @@
+/*
+ Name:		PCF8574LCDRefreshScheduler.h
+ Created:	16/10/2026 10:04:58 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDRefreshScheduler_h
+#define _PCF8574LCDRefreshScheduler_h
+
+#include "PCF8574LCDFrameBuffer.h"
+
+/// <summary>
+/// Scheduler sending content of given frame buffer type within budget of chars and time for each update, so time of loop is bounded
+/// regardless of how much content was changed. Screen is divided into rectangular regions with priorities. Changed chars of regions
+/// with higher priority are sent first, then chars outside of regions, and content that didn't fit into budget is sent by next updates.
+/// </summary>
+template<typename FrameBuffer, uint8_t MaxRegions = 8>
+class PCF8574LCDRefreshScheduler final
+{
+public:
+	/// <summary>
+	/// Value returned by addRegion when there is no space for region.
+	/// </summary>
+	static const uint8_t noRegion = 0xFF;
+
+	/// <summary>
+	/// Adds rectangular region of screen. Regions shouldn't overlap.
+	/// </summary>
+	/// <param name="x">Char position of left edge of region</param>
+	/// <param name="y">Line of top edge of region</param>
+	/// <param name="width">Number of chars in line of region</param>
+	/// <param name="height">Number of lines of region</param>
+	/// <param name="priority">Priority of region, higher is sent first. Regions with equal priority are sent in order of adding</param>
+	/// <returns>Identifier of region, or noRegion if there is no space for it</returns>
+	uint8_t addRegion(const uint8_t& x, const uint8_t& y, const uint8_t& width, const uint8_t& height, const uint8_t& priority);
+
+	/// <summary>
+	/// Changes priority of region.
+	/// </summary>
+	/// <param name="region">Identifier returned by addRegion</param>
+	/// <param name="priority">New priority, higher is sent first. Regions with equal priority are sent in order of adding</param>
+	void setRegionPriority(const uint8_t& region, const uint8_t& priority);
+
+	/// <summary>
+	/// Checks if region contains chars not sent to display.
+	/// </summary>
+	/// <param name="region">Identifier returned by addRegion</param>
+	/// <returns>True if region waits for update</returns>
+	bool isRegionPending(const uint8_t& region);
+
+	/// <summary>
+	/// Checks if frame buffer contains chars not sent to display.
+	/// </summary>
+	/// <returns>True if update is needed</returns>
+	bool hasPendingContent(void) { return m_frameBuffer.isDirty(); }
+
+	/// <summary>
+	/// Sends changed chars, starting from region with highest priority, until budget of chars or time is used. Time is checked before each line,
+	/// so it may be exceeded by time of sending one line.
+	/// </summary>
+	/// <param name="maxChars">Maximum number of chars to send</param>
+	/// <param name="maxTime">Maximum time of update in microseconds, 0 = no limit</param>
+	/// <returns>Number of sent chars</returns>
+	uint16_t update(const uint16_t& maxChars, const uint16_t& maxTime = 0);
+
+	/// <summary>
+	/// Constructor for refresh scheduler.
+	/// </summary>
+	/// <param name="frameBuffer">Frame buffer with content of screen</param>
+	PCF8574LCDRefreshScheduler(FrameBuffer& frameBuffer) : m_frameBuffer(frameBuffer) {}
+
+	PCF8574LCDRefreshScheduler(const PCF8574LCDRefreshScheduler&) = delete;
+	PCF8574LCDRefreshScheduler& operator=(const PCF8574LCDRefreshScheduler&) = delete;
+
+private:
+	/// <summary>
+	/// Frame buffer with content of screen.
+	/// </summary>
+	FrameBuffer& m_frameBuffer;
+
+	/// <summary>
+	/// Area of each region: x, y, width, height.
+	/// </summary>
+	uint8_t m_regions[MaxRegions][4] = {};
+
+	/// <summary>
+	/// Priority of each region.
+	/// </summary>
+	uint8_t m_priorities[MaxRegions] = {};
+
+	/// <summary>
+	/// Identifiers of regions sorted from highest priority.
+	/// </summary>
+	uint8_t m_order[MaxRegions] = {};
+
+	/// <summary>
+	/// Number of regions.
+	/// </summary>
+	uint8_t m_regionsCount = 0;
+
+private:
+	/// <summary>
+	/// Moves region in order of sending, so regions stay sorted by priority.
+	/// </summary>
+	/// <param name="position">Position of region in order</param>
+	void sortRegion(uint8_t position);
+
+	/// <summary>
+	/// Checks if region is sent before other region: it has higher priority, or equal priority and it was added earlier.
+	/// </summary>
+	/// <param name="region">Identifier of region</param>
+	/// <param name="otherRegion">Identifier of other region</param>
+	/// <returns>True if region is sent first</returns>
+	bool isSentBefore(const uint8_t& region, const uint8_t& otherRegion) { return m_priorities[region] != m_priorities[otherRegion] ? m_priorities[region] > m_priorities[otherRegion] : region < otherRegion; }
+
+	/// <summary>
+	/// Sends changed chars of area line by line, until budget is used.
+	/// </summary>
+	/// <param name="area">Area: x, y, width, height</param>
+	/// <param name="sentChars">Number of sent chars, increased by sent chars</param>
+	/// <param name="maxChars">Maximum number of chars to send</param>
+	/// <param name="startTime">Time in microseconds when update started</param>
+	/// <param name="maxTime">Maximum time of update in microseconds, 0 = no limit</param>
+	/// <returns>True if budget is left</returns>
+	bool updateArea(const uint8_t area[], uint16_t& sentChars, const uint16_t& maxChars, const unsigned long& startTime, const uint16_t& maxTime);
+};
+
+template<typename FrameBuffer, uint8_t MaxRegions>
+uint8_t PCF8574LCDRefreshScheduler<FrameBuffer, MaxRegions>::addRegion(const uint8_t& x, const uint8_t& y, const uint8_t& width, const uint8_t& height, const uint8_t& priority)
+{
+	if (m_regionsCount == MaxRegions) return noRegion;
+
+	uint8_t region = m_regionsCount++;
+	m_regions[region][0] = x;
+	m_regions[region][1] = y;
+	m_regions[region][2] = width;
+	m_regions[region][3] = height;
+	m_priorities[region] = priority;
+	m_order[region] = region;
+
+	sortRegion(region);
+	return region;
+}
+
+template<typename FrameBuffer, uint8_t MaxRegions>
+void PCF8574LCDRefreshScheduler<FrameBuffer, MaxRegions>::setRegionPriority(const uint8_t& region, const uint8_t& priority)
+{
+	if (region >= m_regionsCount) return;
+
+	m_priorities[region] = priority;
+	for (uint8_t i = 0; i < m_regionsCount; i++)
+	{
+		if (m_order[i] == region) { sortRegion(i); return; }
+	}
+}
+
+template<typename FrameBuffer, uint8_t MaxRegions>
+bool PCF8574LCDRefreshScheduler<FrameBuffer, MaxRegions>::isRegionPending(const uint8_t& region)
+{
+	if (region >= m_regionsCount) return false;
+
+	return m_frameBuffer.isAreaDirty(m_regions[region][0], m_regions[region][1], m_regions[region][2], m_regions[region][3]);
+}
+
+template<typename FrameBuffer, uint8_t MaxRegions>
+uint16_t PCF8574LCDRefreshScheduler<FrameBuffer, MaxRegions>::update(const uint16_t& maxChars, const uint16_t& maxTime)
+{
+	const unsigned long startTime = micros();
+	uint16_t sentChars = 0;
+
+	for (uint8_t i = 0; i < m_regionsCount; i++)
+	{
+		if (!updateArea(m_regions[m_order[i]], sentChars, maxChars, startTime, maxTime)) return sentChars;
+	}
+
+	const uint8_t screen[4] = { 0, 0, m_frameBuffer.getDisplaySizeX(), m_frameBuffer.getDisplaySizeY() };//chars outside of regions, regions are already sent
+	updateArea(screen, sentChars, maxChars, startTime, maxTime);
+	return sentChars;
+}
+
+template<typename FrameBuffer, uint8_t MaxRegions>
+void PCF8574LCDRefreshScheduler<FrameBuffer, MaxRegions>::sortRegion(uint8_t position)
+{
+	const uint8_t region = m_order[position];
+
+	while (position > 0 && isSentBefore(region, m_order[position - 1]))//move towards higher priorities
+	{
+		m_order[position] = m_order[position - 1];
+		position--;
+	}
+	while (position < m_regionsCount - 1 && isSentBefore(m_order[position + 1], region))//move towards lower priorities
+	{
+		m_order[position] = m_order[position + 1];
+		position++;
+	}
+
+	m_order[position] = region;
+}
+
+template<typename FrameBuffer, uint8_t MaxRegions>
+bool PCF8574LCDRefreshScheduler<FrameBuffer, MaxRegions>::updateArea(const uint8_t area[], uint16_t& sentChars, const uint16_t& maxChars, const unsigned long& startTime, const uint16_t& maxTime)
+{
+	for (uint8_t line = area[1]; line < area[1] + area[3]; line++)
+	{
+		if (sentChars >= maxChars || (maxTime && micros() - startTime >= maxTime)) return false;
+
+		sentChars += m_frameBuffer.flushArea(area[0], line, area[2], 1, maxChars - sentChars);
+	}
+
+	return sentChars < maxChars;
+}
+
+#endif
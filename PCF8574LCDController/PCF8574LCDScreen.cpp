@@ -0,0 +1,12 @@
+/*
+ Name:		PCF8574LCDScreen.cpp
+ Created:	17/10/2026 02:14:37 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDScreen.h"
+
+template class BasicPCF8574LCDScreen<PCF8574LCDController>;
+template class BasicPCF8574LCDScreen<PCF8574BufferedLCDController>;
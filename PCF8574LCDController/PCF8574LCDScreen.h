@@ -0,0 +1,202 @@
+/*
+ Name:		PCF8574LCDScreen.h
+ Created:	17/10/2026 02:14:37 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDScreen_h
+#define _PCF8574LCDScreen_h
+
+#include "PCF8574LCDController.h"
+
+/// <summary>
+/// Field of screen template, part of line showing changing value.
+/// </summary>
+struct PCF8574LCDScreenField
+{
+	uint8_t x;
+	uint8_t y;
+	uint8_t width;
+};
+
+/// <summary>
+/// Screen template for given display type. Layout of whole screen and table of its fields are kept in program memory (PROGMEM),
+/// so static text of screen takes no RAM. Layout is a string with all lines of screen one after another, each exactly as long
+/// as display line, and chars of layout in place of fields are shown until fields are set. Each line of layout is streamed
+/// from flash to display in one burst, and fields are then updated without sending static text again.
+/// </summary>
+template<typename Display>
+class BasicPCF8574LCDScreen final
+{
+public:
+	/// <summary>
+	/// Displays whole layout. Each line is sent in one burst, read from program memory.
+	/// </summary>
+	void show(void);
+
+	/// <summary>
+	/// Sets cursor to beginning of field, so value may be displayed with print or PCF8574LCDFormat functions.
+	/// </summary>
+	/// <param name="field">Number of field</param>
+	/// <returns>Width of field, 0 if there is no such field</returns>
+	uint8_t selectField(const uint8_t& field);
+
+	/// <summary>
+	/// Displays text in field, aligned to left. Rest of field is filled with blanks and text longer than field is cut.
+	/// </summary>
+	/// <param name="field">Number of field</param>
+	/// <param name="text">Text to display</param>
+	void setField(const uint8_t& field, const char text[]) { setField(field, text, strlen(text), false); }
+
+	/// <summary>
+	/// Displays text stored in program memory in field, aligned to left, for example F("text"). Rest of field is filled with blanks
+	/// and text longer than field is cut.
+	/// </summary>
+	/// <param name="field">Number of field</param>
+	/// <param name="text">Text in program memory</param>
+	void setField(const uint8_t& field, const __FlashStringHelper* text) { setField(field, reinterpret_cast<PGM_P>(text), strlen_P(reinterpret_cast<PGM_P>(text)), true); }
+
+	/// <summary>
+	/// Displays chars of layout in place of field again.
+	/// </summary>
+	/// <param name="field">Number of field</param>
+	void clearField(const uint8_t& field);
+
+	/// <summary>
+	/// Returns number of fields.
+	/// </summary>
+	/// <returns>Number of fields</returns>
+	uint8_t getFieldsCount(void) { return m_fieldsCount; }
+
+	/// <summary>
+	/// Constructor for screen template. Layout and fields are not copied, so they must be stored in program memory.
+	/// </summary>
+	/// <param name="display">Display showing screen</param>
+	/// <param name="layout">Chars of all lines in program memory, each line as long as display line</param>
+	/// <param name="fields">Fields of screen in program memory</param>
+	/// <param name="fieldsCount">Number of fields</param>
+	BasicPCF8574LCDScreen(Display& display, const char layout[], const PCF8574LCDScreenField fields[] = nullptr, const uint8_t& fieldsCount = 0);
+
+	BasicPCF8574LCDScreen(const BasicPCF8574LCDScreen&) = delete;
+	BasicPCF8574LCDScreen& operator=(const BasicPCF8574LCDScreen&) = delete;
+
+private:
+	/// <summary>
+	/// Display showing screen.
+	/// </summary>
+	Display& m_display;
+
+	/// <summary>
+	/// Chars of all lines in program memory.
+	/// </summary>
+	const char* const m_layout;
+
+	/// <summary>
+	/// Fields of screen in program memory.
+	/// </summary>
+	const PCF8574LCDScreenField* const m_fields;
+
+	/// <summary>
+	/// Number of fields.
+	/// </summary>
+	const uint8_t m_fieldsCount;
+
+private:
+	/// <summary>
+	/// Reads field from program memory and sets cursor to its beginning.
+	/// </summary>
+	/// <param name="field">Number of field</param>
+	/// <param name="fieldData">Readed field</param>
+	/// <returns>True if there is such field</returns>
+	bool loadField(const uint8_t& field, PCF8574LCDScreenField& fieldData);
+
+	/// <summary>
+	/// Displays text in field, followed by blanks.
+	/// </summary>
+	/// <param name="field">Number of field</param>
+	/// <param name="text">Text to display</param>
+	/// <param name="length">Length of text</param>
+	/// <param name="fromFlash">True if text is stored in program memory</param>
+	void setField(const uint8_t& field, const char text[], size_t length, const bool& fromFlash);
+};
+
+template<typename Display>
+BasicPCF8574LCDScreen<Display>::BasicPCF8574LCDScreen(Display& display, const char layout[], const PCF8574LCDScreenField fields[], const uint8_t& fieldsCount) :
+	m_display(display), m_layout(layout), m_fields(fields), m_fieldsCount(fields == nullptr ? 0 : fieldsCount)
+{
+}
+
+template<typename Display>
+void BasicPCF8574LCDScreen<Display>::show(void)
+{
+	const uint8_t sizeX = m_display.getDisplaySizeX();
+
+	for (uint8_t line = 0; line < m_display.getDisplaySizeY(); line++)
+	{
+		m_display.setCursorToPosition(0, line);
+		m_display.displayDataFromFlash(&m_layout[line * sizeX], sizeX);
+	}
+
+	m_display.sendBufferedData();
+}
+
+template<typename Display>
+uint8_t BasicPCF8574LCDScreen<Display>::selectField(const uint8_t& field)
+{
+	PCF8574LCDScreenField fieldData;
+	return loadField(field, fieldData) ? fieldData.width : 0;
+}
+
+template<typename Display>
+void BasicPCF8574LCDScreen<Display>::clearField(const uint8_t& field)
+{
+	PCF8574LCDScreenField fieldData;
+	if (!loadField(field, fieldData)) return;
+
+	m_display.displayDataFromFlash(&m_layout[fieldData.y * m_display.getDisplaySizeX() + fieldData.x], fieldData.width);
+}
+
+template<typename Display>
+bool BasicPCF8574LCDScreen<Display>::loadField(const uint8_t& field, PCF8574LCDScreenField& fieldData)
+{
+	if (field >= m_fieldsCount) return false;
+
+	memcpy_P(&fieldData, &m_fields[field], sizeof(fieldData));
+	if (fieldData.x >= m_display.getDisplaySizeX() || fieldData.y >= m_display.getDisplaySizeY()) return false;
+	if (fieldData.width > m_display.getDisplaySizeX() - fieldData.x) fieldData.width = m_display.getDisplaySizeX() - fieldData.x;//field can't exceed line
+
+	m_display.setCursorToPosition(fieldData.x, fieldData.y);
+	return true;
+}
+
+template<typename Display>
+void BasicPCF8574LCDScreen<Display>::setField(const uint8_t& field, const char text[], size_t length, const bool& fromFlash)
+{
+	PCF8574LCDScreenField fieldData;
+	if (!loadField(field, fieldData)) return;
+
+	if (length > fieldData.width) length = fieldData.width;
+	if (fromFlash) m_display.displayDataFromFlash(text, length);
+	else m_display.displayData(text, length);
+
+	char blanks[40];
+	memset(blanks, ' ', sizeof(blanks));
+	if (fieldData.width > length) m_display.displayData(blanks, fieldData.width - length);//field is never longer than display line
+}
+
+/// <summary>
+/// Screen template for PCF8574LCDController.
+/// </summary>
+typedef BasicPCF8574LCDScreen<PCF8574LCDController> PCF8574LCDScreen;
+
+/// <summary>
+/// Screen template for PCF8574BufferedLCDController.
+/// </summary>
+typedef BasicPCF8574LCDScreen<PCF8574BufferedLCDController> PCF8574BufferedLCDScreen;
+
+extern template class BasicPCF8574LCDScreen<PCF8574LCDController>;
+extern template class BasicPCF8574LCDScreen<PCF8574BufferedLCDController>;
+
+#endif
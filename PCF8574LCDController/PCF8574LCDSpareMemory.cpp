@@ -0,0 +1,12 @@
+/*
+ Name:		PCF8574LCDSpareMemory.cpp
+ Created:	16/10/2026 06:20:47 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDSpareMemory.h"
+
+template class BasicPCF8574LCDSpareMemory<PCF8574LCDController>;
+template class BasicPCF8574LCDSpareMemory<PCF8574BufferedLCDController>;
@@ -0,0 +1,184 @@
+/*
+ Name:		PCF8574LCDSpareMemory.h
+ Created:	16/10/2026 06:20:47 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDSpareMemory_h
+#define _PCF8574LCDSpareMemory_h
+
+#include "PCF8574LCDController.h"
+
+/// <summary>
+/// Allocator of DDRAM not shown on given display type. DDRAM has 80 bytes, but display shows only size x lines of them,
+/// so remaining bytes at the end of each DDRAM line may be used as additional RAM, with writeDataToDDRAM and readDataFromDDRAM of display.
+/// Stored data is lost after clear display, and is shown on display when display is shifted.
+/// </summary>
+template<typename Display>
+class BasicPCF8574LCDSpareMemory final
+{
+public:
+	/// <summary>
+	/// Value returned by allocate when there is no free block of given size.
+	/// </summary>
+	static const uint8_t noAddress = 0xFF;
+
+	/// <summary>
+	/// Allocates block of spare DDRAM. Block is never split between DDRAM lines, so it may be read and written in one burst.
+	/// </summary>
+	/// <param name="size">Number of bytes</param>
+	/// <returns>DDRAM address of first byte of block, or noAddress if there is no free block of given size</returns>
+	uint8_t allocate(const uint8_t& size);
+
+	/// <summary>
+	/// Releases block of spare DDRAM.
+	/// </summary>
+	/// <param name="address">DDRAM address returned by allocate</param>
+	/// <param name="size">Number of bytes given to allocate</param>
+	void release(const uint8_t& address, const uint8_t& size);
+
+	/// <summary>
+	/// Returns number of spare DDRAM bytes.
+	/// </summary>
+	/// <returns>Number of bytes not shown on display</returns>
+	uint8_t getTotalSpace(void) { return (m_rowLength - m_spareStart[0]) + (m_rowsCount > 1 ? m_rowLength - m_spareStart[1] : 0); }
+
+	/// <summary>
+	/// Returns number of not allocated spare DDRAM bytes.
+	/// </summary>
+	/// <returns>Number of free bytes</returns>
+	uint8_t getFreeSpace(void);
+
+	/// <summary>
+	/// Constructor for spare DDRAM allocator. Spare regions are found from size, line addresses and number of DDRAM lines of display.
+	/// </summary>
+	/// <param name="display">Display with DDRAM used by allocator</param>
+	BasicPCF8574LCDSpareMemory(Display& display);
+
+	BasicPCF8574LCDSpareMemory(const BasicPCF8574LCDSpareMemory&) = delete;
+	BasicPCF8574LCDSpareMemory& operator=(const BasicPCF8574LCDSpareMemory&) = delete;
+
+private:
+	/// <summary>
+	/// Number of DDRAM lines, 2 in two line mode and 1 in one line mode.
+	/// </summary>
+	const uint8_t m_rowsCount;
+
+	/// <summary>
+	/// Number of bytes in DDRAM line, 40 in two line mode and 80 in one line mode.
+	/// </summary>
+	const uint8_t m_rowLength;
+
+	/// <summary>
+	/// Position of first not shown byte in each DDRAM line.
+	/// </summary>
+	uint8_t m_spareStart[2] = {};
+
+	/// <summary>
+	/// One bit for each DDRAM byte, set if byte is allocated.
+	/// </summary>
+	uint8_t m_allocatedBytes[10] = {};
+
+private:
+	/// <summary>
+	/// Checks if byte is allocated.
+	/// </summary>
+	/// <param name="index">Index of byte, DDRAM line * line length + position</param>
+	/// <returns>True if allocated</returns>
+	bool isAllocated(const uint8_t& index) { return m_allocatedBytes[index >> 3] & (1 << (index & 0x07)); }
+
+	/// <summary>
+	/// Marks given number of bytes as allocated or free.
+	/// </summary>
+	/// <param name="index">Index of first byte</param>
+	/// <param name="size">Number of bytes</param>
+	/// <param name="allocated">New state</param>
+	void markBytes(const uint8_t& index, const uint8_t& size, const bool& allocated);
+};
+
+template<typename Display>
+BasicPCF8574LCDSpareMemory<Display>::BasicPCF8574LCDSpareMemory(Display& display) :
+	m_rowsCount(display.getCurrentFunctionSet() & 0x08 ? 2 : 1), m_rowLength(display.getCurrentFunctionSet() & 0x08 ? 40 : 80)
+{
+	for (uint8_t i = 0; i < display.getDisplaySizeY() && i < 4; i++)
+	{
+		uint8_t lineAddress = display.getLineAddress(i);
+		uint8_t row = m_rowsCount > 1 && lineAddress >= 0x40 ? 1 : 0;
+		uint8_t lineEnd = (lineAddress & (m_rowsCount > 1 ? 0x3F : 0x7F)) + display.getDisplaySizeX();
+
+		if (lineEnd > m_spareStart[row]) m_spareStart[row] = lineEnd > m_rowLength ? m_rowLength : lineEnd;
+	}
+}
+
+template<typename Display>
+uint8_t BasicPCF8574LCDSpareMemory<Display>::allocate(const uint8_t& size)
+{
+	if (!size) return noAddress;
+
+	for (uint8_t row = 0; row < m_rowsCount; row++)
+	{
+		uint8_t freeBytes = 0;
+
+		for (uint8_t i = m_spareStart[row]; i < m_rowLength; i++)//first fit
+		{
+			freeBytes = isAllocated(row * m_rowLength + i) ? 0 : freeBytes + 1;
+			if (freeBytes < size) continue;
+
+			uint8_t position = i + 1 - size;
+			markBytes(row * m_rowLength + position, size, true);
+			return row * 0x40 + position;
+		}
+	}
+
+	return noAddress;
+}
+
+template<typename Display>
+void BasicPCF8574LCDSpareMemory<Display>::release(const uint8_t& address, const uint8_t& size)
+{
+	uint8_t row = m_rowsCount > 1 && address >= 0x40 ? 1 : 0;
+	uint8_t position = address - row * 0x40;
+
+	if (position < m_spareStart[row] || position + size > m_rowLength) return;
+	markBytes(row * m_rowLength + position, size, false);
+}
+
+template<typename Display>
+uint8_t BasicPCF8574LCDSpareMemory<Display>::getFreeSpace(void)
+{
+	uint8_t freeBytes = 0;
+
+	for (uint8_t row = 0; row < m_rowsCount; row++)
+	{
+		for (uint8_t i = m_spareStart[row]; i < m_rowLength; i++) if (!isAllocated(row * m_rowLength + i)) freeBytes++;
+	}
+
+	return freeBytes;
+}
+
+template<typename Display>
+void BasicPCF8574LCDSpareMemory<Display>::markBytes(const uint8_t& index, const uint8_t& size, const bool& allocated)
+{
+	for (uint8_t i = index; i < index + size; i++)
+	{
+		if (allocated) m_allocatedBytes[i >> 3] |= 1 << (i & 0x07);
+		else m_allocatedBytes[i >> 3] &= ~(1 << (i & 0x07));
+	}
+}
+
+/// <summary>
+/// Spare DDRAM allocator for PCF8574LCDController.
+/// </summary>
+typedef BasicPCF8574LCDSpareMemory<PCF8574LCDController> PCF8574LCDSpareMemory;
+
+/// <summary>
+/// Spare DDRAM allocator for PCF8574BufferedLCDController.
+/// </summary>
+typedef BasicPCF8574LCDSpareMemory<PCF8574BufferedLCDController> PCF8574BufferedLCDSpareMemory;
+
+extern template class BasicPCF8574LCDSpareMemory<PCF8574LCDController>;
+extern template class BasicPCF8574LCDSpareMemory<PCF8574BufferedLCDController>;
+
+#endif
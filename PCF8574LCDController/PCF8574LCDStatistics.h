@@ -0,0 +1,175 @@
+/*
+ Name:		PCF8574LCDStatistics.h
+ Created:	16/10/2026 08:14:37 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDStatistics_h
+#define _PCF8574LCDStatistics_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+//Statistics are counted only when PCF8574_LCD_STATISTICS is defined as 1 for whole build (for example -DPCF8574_LCD_STATISTICS=1 in build flags).
+//When disabled, counting functions are empty and take no RAM.
+#ifndef PCF8574_LCD_STATISTICS
+#define PCF8574_LCD_STATISTICS 0
+#endif
+
+//Statistics change layout of controller, so controller and classes containing it are declared in inline namespace named after this setting.
+//Sketch built with other setting than library refers to other names and fails to link, instead of using controller of wrong layout.
+#if PCF8574_LCD_STATISTICS
+#define PCF8574_LCD_STATISTICS_NAMESPACE PCF8574LCDStatisticsEnabled
+#else
+#define PCF8574_LCD_STATISTICS_NAMESPACE PCF8574LCDStatisticsDisabled
+#endif
+
+/// <summary>
+/// Counters of work done by controller on I2C bus.
+/// </summary>
+struct PCF8574LCDStatistics
+{
+	/// <summary>
+	/// Number of I2C transmissions ended by controller. Transmissions joined later by transport are counted separately.
+	/// </summary>
+	unsigned long transmissions = 0;
+
+	/// <summary>
+	/// Number of bytes written to PCF8574 port.
+	/// </summary>
+	unsigned long writtenBytes = 0;
+
+	/// <summary>
+	/// Number of reads of PCF8574 port.
+	/// </summary>
+	unsigned long reads = 0;
+
+	/// <summary>
+	/// Number of reads of PCF8574 port that returned no byte.
+	/// </summary>
+	unsigned long failedReads = 0;
+
+	/// <summary>
+	/// Number of busy flag reads made while waiting for completion of previous command.
+	/// </summary>
+	unsigned long busyFlagPolls = 0;
+
+	/// <summary>
+	/// Time in microseconds spent waiting for completion of previous command or for space in queue.
+	/// </summary>
+	unsigned long blockedTime = 0;
+};
+
+inline namespace PCF8574_LCD_STATISTICS_NAMESPACE
+{
+
+#if PCF8574_LCD_STATISTICS
+
+/// <summary>
+/// Statistics kept by controller, since start and since last reset of window.
+/// </summary>
+class PCF8574LCDStatisticsCounter
+{
+public:
+	/// <summary>
+	/// Returns statistics counted since start.
+	/// </summary>
+	/// <returns>Counters since start</returns>
+	const PCF8574LCDStatistics& getStatistics(void) const { return m_total; }
+
+	/// <summary>
+	/// Returns statistics counted since last reset of window.
+	/// </summary>
+	/// <returns>Counters since last reset</returns>
+	const PCF8574LCDStatistics& getWindowStatistics(void) const { return m_window; }
+
+	/// <summary>
+	/// Starts new window, by clearing statistics counted since last reset.
+	/// </summary>
+	void resetWindowStatistics(void) { m_window = PCF8574LCDStatistics(); }
+
+protected:
+	/// <summary>
+	/// Counts ended transmission.
+	/// </summary>
+	/// <param name="length">Number of bytes in transmission</param>
+	void countTransmission(const uint8_t& length) { m_total.transmissions++; m_window.transmissions++; m_total.writtenBytes += length; m_window.writtenBytes += length; }
+
+	/// <summary>
+	/// Counts read of port.
+	/// </summary>
+	/// <param name="succeeded">True if byte was readed</param>
+	void countRead(const bool& succeeded) { m_total.reads++; m_window.reads++; if (!succeeded) { m_total.failedReads++; m_window.failedReads++; } }
+
+	/// <summary>
+	/// Counts busy flag read.
+	/// </summary>
+	void countBusyFlagPoll(void) { m_total.busyFlagPolls++; m_window.busyFlagPolls++; }
+
+	/// <summary>
+	/// Counts time of waiting.
+	/// </summary>
+	/// <param name="startTime">Time in microseconds when waiting started</param>
+	void countBlockedTime(const unsigned long& startTime) { unsigned long time = micros() - startTime; m_total.blockedTime += time; m_window.blockedTime += time; }
+
+	/// <summary>
+	/// Returns time used as start of waiting.
+	/// </summary>
+	/// <returns>Time in microseconds</returns>
+	unsigned long getBlockingStartTime(void) { return micros(); }
+
+private:
+	/// <summary>
+	/// Counters since start.
+	/// </summary>
+	PCF8574LCDStatistics m_total;
+
+	/// <summary>
+	/// Counters since last reset of window.
+	/// </summary>
+	PCF8574LCDStatistics m_window;
+};
+
+#else
+
+/// <summary>
+/// Statistics disabled at compile time. All counting functions are empty and all counters read as 0.
+/// </summary>
+class PCF8574LCDStatisticsCounter
+{
+public:
+	/// <summary>
+	/// Returns statistics counted since start.
+	/// </summary>
+	/// <returns>Counters equal to 0</returns>
+	PCF8574LCDStatistics getStatistics(void) const { return PCF8574LCDStatistics(); }
+
+	/// <summary>
+	/// Returns statistics counted since last reset of window.
+	/// </summary>
+	/// <returns>Counters equal to 0</returns>
+	PCF8574LCDStatistics getWindowStatistics(void) const { return PCF8574LCDStatistics(); }
+
+	/// <summary>
+	/// Starts new window. Does nothing.
+	/// </summary>
+	void resetWindowStatistics(void) {}
+
+protected:
+	void countTransmission(const uint8_t&) {}
+	void countRead(const bool&) {}
+	void countBusyFlagPoll(void) {}
+	void countBlockedTime(const unsigned long&) {}
+	unsigned long getBlockingStartTime(void) { return 0; }
+};
+
+#endif // PCF8574_LCD_STATISTICS
+
+} // namespace PCF8574_LCD_STATISTICS_NAMESPACE
+
+#endif
@@ -0,0 +1,197 @@
+/*
+ Name:		PCF8574LCDSubmissionQueue.h
+ Created:	17/10/2026 12:21:09 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDSubmissionQueue_h
+#define _PCF8574LCDSubmissionQueue_h
+
+#include "PCF8574LCDFrameBuffer.h"
+
+//Submission queue uses std::atomic, so it is available only for targets with atomic operations in their toolchain (ESP32, ARM, host computer),
+//and it is not included by other files of library.
+#include <atomic>
+
+/// <summary>
+/// Lock-free queue of text updates for frame buffer of given type, for many tasks or cores writing to one display.
+/// Any number of producers submit text without blocking and without waiting for I2C bus, and one display task drains submitted text
+/// into frame buffer and flushes it. Text written later to the same chars replaces earlier one in frame buffer, so each char is sent
+/// to display at most once per update, regardless of how many times it was changed.
+/// Producers take slots by compare and swap on position counter, and slot is published to display task by its sequence number,
+/// so submit may be called from interrupts and other cores, but drain and update only from one task.
+/// </summary>
+template<typename FrameBuffer, uint8_t Capacity = 16, uint8_t RecordLength = 20>
+class PCF8574LCDSubmissionQueue final
+{
+	static_assert(Capacity && !(Capacity & (Capacity - 1)), "Capacity of submission queue must be a power of two");
+
+public:
+	/// <summary>
+	/// Submits text displayed from given position. Text longer than record length is submitted as many records. Never blocks.
+	/// </summary>
+	/// <param name="x">Char position</param>
+	/// <param name="y">Line</param>
+	/// <param name="text">Chars to display</param>
+	/// <param name="length">Number of chars</param>
+	/// <returns>True if whole text was submitted, false if queue was full and remaining chars were dropped</returns>
+	bool submit(const uint8_t& x, const uint8_t& y, const char text[], const uint8_t& length);
+
+	/// <summary>
+	/// Submits null-terminated text displayed from given position. Never blocks.
+	/// </summary>
+	/// <param name="x">Char position</param>
+	/// <param name="y">Line</param>
+	/// <param name="text">Null-terminated chars to display</param>
+	/// <returns>True if whole text was submitted, false if queue was full and remaining chars were dropped</returns>
+	bool submit(const uint8_t& x, const uint8_t& y, const char text[]) { size_t length = strlen(text); return submit(x, y, text, length > 0xFF ? 0xFF : length); }
+
+	/// <summary>
+	/// Moves all submitted text into frame buffer. Only for display task.
+	/// </summary>
+	/// <returns>Number of drained records</returns>
+	uint16_t drain(void);
+
+	/// <summary>
+	/// Moves all submitted text into frame buffer and sends changed chars to display. Only for display task.
+	/// </summary>
+	/// <returns>Number of chars sent to display</returns>
+	uint16_t update(void) { drain(); return m_frameBuffer.flush(); }
+
+	/// <summary>
+	/// Returns number of records dropped because queue was full.
+	/// </summary>
+	/// <returns>Number of dropped records</returns>
+	unsigned long getDroppedCount(void) { return m_droppedCount.load(std::memory_order_relaxed); }
+
+	/// <summary>
+	/// Constructor for submission queue.
+	/// </summary>
+	/// <param name="frameBuffer">Frame buffer with content of screen, used only by display task</param>
+	PCF8574LCDSubmissionQueue(FrameBuffer& frameBuffer);
+
+	PCF8574LCDSubmissionQueue(const PCF8574LCDSubmissionQueue&) = delete;
+	PCF8574LCDSubmissionQueue& operator=(const PCF8574LCDSubmissionQueue&) = delete;
+
+private:
+	/// <summary>
+	/// Slot of queue with one record of text.
+	/// </summary>
+	struct Slot
+	{
+		/// <summary>
+		/// Position for which slot is free (equal to position) or published (position + 1).
+		/// </summary>
+		std::atomic<uint16_t> sequence;
+
+		uint8_t x;
+		uint8_t y;
+		uint8_t length;
+		char text[RecordLength];
+	};
+
+	/// <summary>
+	/// Frame buffer with content of screen.
+	/// </summary>
+	FrameBuffer& m_frameBuffer;
+
+	/// <summary>
+	/// Slots of queue.
+	/// </summary>
+	Slot m_slots[Capacity];
+
+	/// <summary>
+	/// Position of next slot taken by producer.
+	/// </summary>
+	std::atomic<uint16_t> m_enqueuePosition;
+
+	/// <summary>
+	/// Position of next slot drained by display task.
+	/// </summary>
+	uint16_t m_dequeuePosition = 0;
+
+	/// <summary>
+	/// Number of records dropped because queue was full.
+	/// </summary>
+	std::atomic<unsigned long> m_droppedCount;
+
+private:
+	/// <summary>
+	/// Takes free slot for producer.
+	/// </summary>
+	/// <param name="position">Position of taken slot</param>
+	/// <returns>True if slot was taken, false if queue is full</returns>
+	bool takeSlot(uint16_t& position);
+};
+
+template<typename FrameBuffer, uint8_t Capacity, uint8_t RecordLength>
+PCF8574LCDSubmissionQueue<FrameBuffer, Capacity, RecordLength>::PCF8574LCDSubmissionQueue(FrameBuffer& frameBuffer) :
+	m_frameBuffer(frameBuffer), m_enqueuePosition(0), m_droppedCount(0)
+{
+	for (uint8_t i = 0; i < Capacity; i++) m_slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template<typename FrameBuffer, uint8_t Capacity, uint8_t RecordLength>
+bool PCF8574LCDSubmissionQueue<FrameBuffer, Capacity, RecordLength>::submit(const uint8_t& x, const uint8_t& y, const char text[], const uint8_t& length)
+{
+	for (uint16_t offset = 0; offset < length; offset += RecordLength)//16 bits, so offset past 255 ends loop instead of wrapping
+	{
+		uint16_t position;
+		if (!takeSlot(position))
+		{
+			m_droppedCount.fetch_add((length - offset + RecordLength - 1) / RecordLength, std::memory_order_relaxed);//this and all remaining records
+			return false;
+		}
+
+		Slot& slot = m_slots[position % Capacity];
+		slot.x = x + offset;
+		slot.y = y;
+		slot.length = length - offset < RecordLength ? length - offset : RecordLength;
+		memcpy(slot.text, &text[offset], slot.length);
+
+		slot.sequence.store(position + 1, std::memory_order_release);//publish record to display task
+	}
+
+	return true;
+}
+
+template<typename FrameBuffer, uint8_t Capacity, uint8_t RecordLength>
+bool PCF8574LCDSubmissionQueue<FrameBuffer, Capacity, RecordLength>::takeSlot(uint16_t& position)
+{
+	position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+	for (;;)
+	{
+		int16_t difference = static_cast<int16_t>(m_slots[position % Capacity].sequence.load(std::memory_order_acquire) - position);
+
+		if (difference == 0)//slot is free, take it if no other producer did it first
+		{
+			if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) return true;
+		}
+		else if (difference < 0) return false;//slot still holds record from previous round
+		else position = m_enqueuePosition.load(std::memory_order_relaxed);//other producer took slot
+	}
+}
+
+template<typename FrameBuffer, uint8_t Capacity, uint8_t RecordLength>
+uint16_t PCF8574LCDSubmissionQueue<FrameBuffer, Capacity, RecordLength>::drain(void)
+{
+	uint16_t drainedRecords = 0;
+
+	for (;;)
+	{
+		Slot& slot = m_slots[m_dequeuePosition % Capacity];
+		if (slot.sequence.load(std::memory_order_acquire) != static_cast<uint16_t>(m_dequeuePosition + 1)) return drainedRecords;//not published yet
+
+		m_frameBuffer.setCursorToPosition(slot.x, slot.y);
+		m_frameBuffer.displayData(slot.text, slot.length);
+
+		slot.sequence.store(m_dequeuePosition + Capacity, std::memory_order_release);//free slot for next round
+		m_dequeuePosition++;
+		drainedRecords++;
+	}
+}
+
+#endif
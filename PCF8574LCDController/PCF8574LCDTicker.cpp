@@ -0,0 +1,12 @@
+/*
+ Name:		PCF8574LCDTicker.cpp
+ Created:	16/10/2026 07:02:16 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "PCF8574LCDTicker.h"
+
+template class BasicPCF8574LCDTicker<PCF8574LCDController>;
+template class BasicPCF8574LCDTicker<PCF8574BufferedLCDController>;
@@ -0,0 +1,210 @@
+/*
+ Name:		PCF8574LCDTicker.h
+ Created:	16/10/2026 07:02:16 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDTicker_h
+#define _PCF8574LCDTicker_h
+
+#include "PCF8574LCDController.h"
+
+/// <summary>
+/// Ticker scrolling text on given display type by display shift command. Text is loaded into whole DDRAM line (40 chars in two line mode,
+/// 80 in one line mode) and each step is one shift command. Text longer than DDRAM line is continued by writing one char into column
+/// that left the view, so it comes back into view with next part of text. That char is written without moving address counter back,
+/// so with one scrolled line the counter already points at the next column and address is set only after it was changed elsewhere.
+/// Display shift moves all lines at once, so text on other lines moves too. On four line displays lines 0 and 2, and lines 1 and 3,
+/// are parts of the same DDRAM line, so ticker text continues from one of them to the other.
+/// </summary>
+template<typename Display>
+class BasicPCF8574LCDTicker final
+{
+public:
+	/// <summary>
+	/// Sets text scrolled on DDRAM line holding given display line. Text is not copied, so it must exist while ticker is used.
+	/// New text is loaded by start.
+	/// </summary>
+	/// <param name="line">Display line</param>
+	/// <param name="text">Text to scroll, nullptr to leave line unchanged</param>
+	void setText(const uint8_t& line, const char text[]);
+
+	/// <summary>
+	/// Sets time between steps.
+	/// </summary>
+	/// <param name="stepInterval">Time in milliseconds</param>
+	void setStepInterval(const uint16_t& stepInterval) { m_stepInterval = stepInterval; }
+
+	/// <summary>
+	/// Loads texts into DDRAM, moves display to home position and starts scrolling. Call it again after clear display or return home,
+	/// because they cancel display shift.
+	/// </summary>
+	void start(void);
+
+	/// <summary>
+	/// Stops scrolling. Display stays shifted until return home.
+	/// </summary>
+	void stop(void) { m_running = false; }
+
+	/// <summary>
+	/// Performs step of scrolling if step interval passed since previous one. Never waits.
+	/// </summary>
+	/// <returns>True if step was performed</returns>
+	bool update(void);
+
+	/// <summary>
+	/// Constructor for ticker.
+	/// </summary>
+	/// <param name="display">Display used by ticker</param>
+	/// <param name="stepInterval">Time between steps in milliseconds</param>
+	BasicPCF8574LCDTicker(Display& display, const uint16_t& stepInterval = 300);
+
+	BasicPCF8574LCDTicker(const BasicPCF8574LCDTicker&) = delete;
+	BasicPCF8574LCDTicker& operator=(const BasicPCF8574LCDTicker&) = delete;
+
+private:
+	/// <summary>
+	/// Display used by ticker.
+	/// </summary>
+	Display& m_display;
+
+	/// <summary>
+	/// Number of DDRAM lines, 2 in two line mode and 1 in one line mode.
+	/// </summary>
+	const uint8_t m_rowsCount;
+
+	/// <summary>
+	/// Number of chars in DDRAM line, 40 in two line mode and 80 in one line mode.
+	/// </summary>
+	const uint8_t m_rowLength;
+
+	/// <summary>
+	/// Text of each DDRAM line.
+	/// </summary>
+	const char* m_texts[2] = {};
+
+	/// <summary>
+	/// Length of text of each DDRAM line.
+	/// </summary>
+	uint16_t m_textLengths[2] = {};
+
+	/// <summary>
+	/// Position in text of char written into DDRAM at next step, used only for texts longer than DDRAM line.
+	/// </summary>
+	uint16_t m_nextChars[2] = {};
+
+	/// <summary>
+	/// DDRAM column shown at the beginning of view.
+	/// </summary>
+	uint8_t m_viewColumn = 0;
+
+	/// <summary>
+	/// Time between steps in milliseconds.
+	/// </summary>
+	uint16_t m_stepInterval;
+
+	/// <summary>
+	/// Time in milliseconds of last step.
+	/// </summary>
+	unsigned long m_lastStepTime = 0;
+
+	/// <summary>
+	/// State of scrolling.
+	/// </summary>
+	bool m_running = false;
+
+private:
+	/// <summary>
+	/// Returns char of text for given column of DDRAM line after loading. Text shorter than DDRAM line is followed by blanks.
+	/// </summary>
+	/// <param name="row">DDRAM line</param>
+	/// <param name="column">Column of DDRAM line</param>
+	/// <returns>Char to display</returns>
+	uint8_t getLoadedChar(const uint8_t& row, const uint8_t& column) { return column < m_textLengths[row] ? m_texts[row][column] : ' '; }
+};
+
+template<typename Display>
+BasicPCF8574LCDTicker<Display>::BasicPCF8574LCDTicker(Display& display, const uint16_t& stepInterval) :
+	m_display(display), m_rowsCount(display.getCurrentFunctionSet() & 0x08 ? 2 : 1), m_rowLength(display.getCurrentFunctionSet() & 0x08 ? 40 : 80),
+	m_stepInterval(stepInterval)
+{
+}
+
+template<typename Display>
+void BasicPCF8574LCDTicker<Display>::setText(const uint8_t& line, const char text[])
+{
+	uint8_t row = m_rowsCount > 1 && m_display.getLineAddress(line) >= 0x40 ? 1 : 0;
+
+	m_texts[row] = text;
+	m_textLengths[row] = text == nullptr ? 0 : strlen(text);
+}
+
+template<typename Display>
+void BasicPCF8574LCDTicker<Display>::start(void)
+{
+	uint8_t chunk[20];
+
+	for (uint8_t row = 0; row < m_rowsCount; row++)
+	{
+		if (m_texts[row] == nullptr) continue;
+
+		for (uint8_t column = 0; column < m_rowLength; column += sizeof(chunk))//whole DDRAM line is loaded, so shifted view never shows old data
+		{
+			for (uint8_t i = 0; i < sizeof(chunk); i++) chunk[i] = getLoadedChar(row, column + i);
+			m_display.writeDataToDDRAM(row * 0x40 + column, chunk, sizeof(chunk));
+		}
+
+		m_nextChars[row] = m_textLengths[row] > m_rowLength ? m_rowLength : 0;
+	}
+
+	m_display.moveToHome();//cancels display shift
+	m_display.sendBufferedData();
+
+	m_viewColumn = 0;
+	m_lastStepTime = millis();
+	m_running = true;
+}
+
+template<typename Display>
+bool BasicPCF8574LCDTicker<Display>::update(void)
+{
+	if (!m_running || millis() - m_lastStepTime < m_stepInterval) return false;
+
+	m_lastStepTime += m_stepInterval;
+	if (millis() - m_lastStepTime >= m_stepInterval) m_lastStepTime = millis();//steps that were missed are skipped
+
+	m_display.shiftDisplayToLeft();
+	uint8_t leftColumn = m_viewColumn;//column that left the view, it will be the last one to come back
+	m_viewColumn = (m_viewColumn + 1) % m_rowLength;
+
+	for (uint8_t row = 0; row < m_rowsCount; row++)
+	{
+		if (m_texts[row] == nullptr || m_textLengths[row] <= m_rowLength) continue;//short text loops by itself
+
+		const uint8_t address = row * 0x40 + leftColumn;
+		const char nextChar = m_texts[row][m_nextChars[row]];
+		if (m_display.isAddressCounterAt(address)) m_display.displayData(nextChar);//previous step left address counter at this column
+		else m_display.writeDataToDDRAM(address, nextChar);
+		m_nextChars[row] = (m_nextChars[row] + 1) % m_textLengths[row];
+	}
+
+	m_display.sendBufferedData();
+	return true;
+}
+
+/// <summary>
+/// Ticker for PCF8574LCDController.
+/// </summary>
+typedef BasicPCF8574LCDTicker<PCF8574LCDController> PCF8574LCDTicker;
+
+/// <summary>
+/// Ticker for PCF8574BufferedLCDController.
+/// </summary>
+typedef BasicPCF8574LCDTicker<PCF8574BufferedLCDController> PCF8574BufferedLCDTicker;
+
+extern template class BasicPCF8574LCDTicker<PCF8574LCDController>;
+extern template class BasicPCF8574LCDTicker<PCF8574BufferedLCDController>;
+
+#endif
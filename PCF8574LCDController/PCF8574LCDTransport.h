@@ -0,0 +1,261 @@
+/*
+ Name:		PCF8574LCDTransport.h
+ Created:	16/10/2026 02:25:48 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _PCF8574LCDTransport_h
+#define _PCF8574LCDTransport_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include <Wire.h>
+
+#if defined(BUFFER_LENGTH)
+#define PCF8574_LCD_I2C_BUFFER_LENGTH BUFFER_LENGTH
+#elif defined(I2C_BUFFER_LENGTH)
+#define PCF8574_LCD_I2C_BUFFER_LENGTH I2C_BUFFER_LENGTH
+#else
+#define PCF8574_LCD_I2C_BUFFER_LENGTH 32
+#endif
+
+//Transport is a class with static functions used by controller for access to I2C bus:
+//beginTransmission(address), write(data), endTransmission(), read(address, data), flush() and bufferLength constant.
+//Transport is chosen by template parameter of controller, so calls are resolved at compile time.
+
+/// <summary>
+/// Transport sending each transmission immediately through given TwoWire object.
+/// </summary>
+template<TwoWire& Bus>
+class PCF8574WireTransport final
+{
+public:
+	/// <summary>
+	/// Maximum number of bytes in one transmission.
+	/// </summary>
+	static const uint8_t bufferLength = PCF8574_LCD_I2C_BUFFER_LENGTH;
+
+	/// <summary>
+	/// Starts transmission to given device.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	static void beginTransmission(const uint8_t& address) { Bus.beginTransmission(address); }
+
+	/// <summary>
+	/// Adds byte to current transmission.
+	/// </summary>
+	/// <param name="data">Byte to send</param>
+	static void write(const uint8_t& data) { Bus.write(data); }
+
+	/// <summary>
+	/// Sends current transmission.
+	/// </summary>
+	static void endTransmission(void) { Bus.endTransmission(); }
+
+	/// <summary>
+	/// Reads one byte from given device.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	/// <param name="data">Readed byte</param>
+	/// <returns>True if byte was readed</returns>
+	static bool read(const uint8_t& address, uint8_t& data)
+	{
+		Bus.requestFrom(address, static_cast<uint8_t>(1));
+		if (Bus.available() != 1) return false;
+		data = Bus.read();
+		return true;
+	}
+
+	/// <summary>
+	/// Sends all deferred transmissions. Transmissions are never deferred by this transport.
+	/// </summary>
+	static void flush(void) {}
+};
+
+/// <summary>
+/// Transport deferring end of transmission until batch is complete. Consecutive transmissions to the same device are joined into one,
+/// until I2C buffer is full, other device is addressed, byte is read or flush is called.
+/// </summary>
+template<TwoWire& Bus>
+class PCF8574BufferedWireTransport final
+{
+public:
+	/// <summary>
+	/// Maximum number of bytes in one transmission.
+	/// </summary>
+	static const uint8_t bufferLength = PCF8574_LCD_I2C_BUFFER_LENGTH;
+
+	/// <summary>
+	/// Starts transmission to given device, or continues deferred transmission to the same device.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	static void beginTransmission(const uint8_t& address)
+	{
+		if (m_transmissionOpen && m_address == address) return;
+
+		flush();
+		Bus.beginTransmission(address);
+		m_address = address;
+		m_bytesInTransmission = 0;
+		m_transmissionOpen = true;
+	}
+
+	/// <summary>
+	/// Adds byte to current transmission. Full transmission is sent and new one is started.
+	/// </summary>
+	/// <param name="data">Byte to send</param>
+	static void write(const uint8_t& data)
+	{
+		if (m_bytesInTransmission == bufferLength)
+		{
+			Bus.endTransmission();
+			Bus.beginTransmission(m_address);
+			m_bytesInTransmission = 0;
+		}
+
+		Bus.write(data);
+		m_bytesInTransmission++;
+	}
+
+	/// <summary>
+	/// Marks end of transmission. Transmission is not sent until flush or until it can't be joined with next one.
+	/// </summary>
+	static void endTransmission(void) {}
+
+	/// <summary>
+	/// Sends deferred transmission and reads one byte from given device.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	/// <param name="data">Readed byte</param>
+	/// <returns>True if byte was readed</returns>
+	static bool read(const uint8_t& address, uint8_t& data)
+	{
+		flush();
+
+		Bus.requestFrom(address, static_cast<uint8_t>(1));
+		if (Bus.available() != 1) return false;
+		data = Bus.read();
+		return true;
+	}
+
+	/// <summary>
+	/// Sends deferred transmission.
+	/// </summary>
+	static void flush(void)
+	{
+		if (!m_transmissionOpen) return;
+
+		Bus.endTransmission();
+		m_transmissionOpen = false;
+	}
+
+private:
+	/// <summary>
+	/// State of deferred transmission.
+	/// </summary>
+	static bool m_transmissionOpen;
+
+	/// <summary>
+	/// I2C address of device in deferred transmission.
+	/// </summary>
+	static uint8_t m_address;
+
+	/// <summary>
+	/// Number of bytes in deferred transmission.
+	/// </summary>
+	static uint8_t m_bytesInTransmission;
+};
+
+template<TwoWire& Bus>
+bool PCF8574BufferedWireTransport<Bus>::m_transmissionOpen = false;
+
+template<TwoWire& Bus>
+uint8_t PCF8574BufferedWireTransport<Bus>::m_address = 0;
+
+template<TwoWire& Bus>
+uint8_t PCF8574BufferedWireTransport<Bus>::m_bytesInTransmission = 0;
+
+/// <summary>
+/// Transport for backpacks with MCP23008 port expander, sending each transmission immediately through given TwoWire object.
+/// Each transmission writes its bytes to GPIO register. Sequential operation is turned off by begin, so register address is not incremented
+/// and all bytes of transmission are port states, as for PCF8574. Backpacks with MCP23008 have R/W line tied low, so nothing is read
+/// and Timed mode must be used.
+/// </summary>
+template<TwoWire& Bus>
+class MCP23008WireTransport final
+{
+public:
+	/// <summary>
+	/// Maximum number of bytes in one transmission, without register address.
+	/// </summary>
+	static const uint8_t bufferLength = PCF8574_LCD_I2C_BUFFER_LENGTH - 1;
+
+	/// <summary>
+	/// Configures all pins of MCP23008 as outputs and disables increment of register address. Must be called before initialization of controller.
+	/// </summary>
+	/// <param name="address">I2C address of MCP23008</param>
+	static void begin(const uint8_t& address)
+	{
+		Bus.beginTransmission(address);
+		Bus.write(m_iodirRegister);
+		Bus.write(0x00);//all pins are outputs
+		Bus.endTransmission();
+
+		Bus.beginTransmission(address);
+		Bus.write(m_ioconRegister);
+		Bus.write(0x20);//SEQOP, register address is not incremented
+		Bus.endTransmission();
+	}
+
+	/// <summary>
+	/// Starts transmission to GPIO register of given device.
+	/// </summary>
+	/// <param name="address">I2C address of device</param>
+	static void beginTransmission(const uint8_t& address) { Bus.beginTransmission(address); Bus.write(m_gpioRegister); }
+
+	/// <summary>
+	/// Adds byte to current transmission.
+	/// </summary>
+	/// <param name="data">Byte to send</param>
+	static void write(const uint8_t& data) { Bus.write(data); }
+
+	/// <summary>
+	/// Sends current transmission.
+	/// </summary>
+	static void endTransmission(void) { Bus.endTransmission(); }
+
+	/// <summary>
+	/// Reads are not possible with R/W line tied low.
+	/// </summary>
+	/// <returns>Always false</returns>
+	static bool read(const uint8_t&, uint8_t&) { return false; }
+
+	/// <summary>
+	/// Sends all deferred transmissions. Transmissions are never deferred by this transport.
+	/// </summary>
+	static void flush(void) {}
+
+private:
+	/// <summary>
+	/// Address of I/O direction register.
+	/// </summary>
+	static const uint8_t m_iodirRegister = 0x00;
+
+	/// <summary>
+	/// Address of configuration register.
+	/// </summary>
+	static const uint8_t m_ioconRegister = 0x05;
+
+	/// <summary>
+	/// Address of GPIO register.
+	/// </summary>
+	static const uint8_t m_gpioRegister = 0x09;
+};
+
+#endif
@@ -0,0 +1,299 @@
+/*
+ Name:		PCF8574LCDControllerBenchmark.ino
+ Created:	16/10/2026 11:40:17 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+*/
+
+//Measures typical workloads on board with display, or in host build (CMakeLists.txt in main directory) with emulator connected
+//to Wire stand-in, which counts transmissions, bytes and reads and gives virtual time following transfer time of bytes at 100kHz and 400kHz.
+//Host build reports counts of bus operations too, and each value above its baseline is reported as regression.
+
+#include "PCF8574LCDController.h"
+#include "PCF8574LCDFrameBuffer.h"
+
+#if defined(PCF8574_LCD_HOST)
+#include "PCF8574LCDEmulator.h"
+
+PCF8574LCDEmulator emulator(20, 4, PCF8574_DEFAULT_ADDRESS);
+
+const uint8_t clocksCount = 2;
+const unsigned long clocks[clocksCount] = { 100000, 400000 };//400kHz only shows how much time is spent on bus, PCF8574 allows 100kHz
+#else
+const uint8_t clocksCount = 1;
+const unsigned long clocks[clocksCount] = { 100000 };//for PCF8574 100khz clock is max
+#endif
+
+PCF8574LCDController* display = nullptr;
+PCF8574LCDFrameBuffer* frameBuffer = nullptr;
+
+const uint8_t benchmarkRepetitions = 10;//each workload is repeated this many times and average time is reported
+const uint8_t allowedSlowdownPercent = 10;//workload slower than baseline by more than this is reported as regression
+
+const uint8_t workloadsCount = 6;
+const char* const workloadNames[workloadsCount] = { "full redraw ", "erase lines ", "CGRAM upload", "DDRAM read  ", "block read  ", "demo loop   " };
+const uint16_t workloadBytes[workloadsCount] = { 80, 80, 64, 80, 80, 0 };//bytes moved by one iteration, 0 = not reported as throughput
+
+//average time of one iteration in microseconds for 20x4 display for each I2C clock, first row for busy flag mode, second for timed mode
+//values were measured by host build, so they contain only time of bus and display, replace them with values printed by this sketch on your board
+unsigned long baselines[clocksCount][2][workloadsCount] = {
+	{
+		{ 41613, 48169, 60557, 349549, 86589, 9068 },
+		{ 33224, 35838, 35794, 179490, 78182, 4444 }
+	},
+#if defined(PCF8574_LCD_HOST)
+	{
+		{ 10496, 12320, 15460, 88484, 21908, 2441 },
+		{ 8744, 9726, 10226, 48930, 19974, 1479 }
+	}
+#endif
+};
+
+#if defined(PCF8574_LCD_HOST)
+//transmissions, bytes on bus (with address bytes) and requestFrom calls of one iteration counted by Wire stand-in of host build for each I2C clock,
+//first row for busy flag mode, second for timed mode, counts of busy flag mode depend on clock, because busy flag is polled until display is ready
+const unsigned long busBaselines[clocksCount][2][workloadsCount][3] = {
+	{
+		{ { 40, 457, 16 }, { 56, 529, 24 }, { 104, 665, 48 }, { 880, 3841, 480 }, { 196, 953, 176 }, { 19, 99, 9 } },
+		{ { 16, 360, 0 }, { 20, 384, 0 }, { 32, 376, 0 }, { 400, 1920, 160 }, { 172, 856, 160 }, { 5, 43, 0 } }
+	},
+	{
+		{ { 40, 456, 16 }, { 57, 535, 25 }, { 105, 671, 49 }, { 881, 3847, 481 }, { 197, 959, 177 }, { 20, 106, 10 } },
+		{ { 16, 360, 0 }, { 20, 384, 0 }, { 32, 376, 0 }, { 400, 1920, 160 }, { 172, 856, 160 }, { 5, 43, 0 } }
+	}
+};
+
+unsigned long busResults[clocksCount][2][workloadsCount][3];
+#endif
+
+unsigned long demoLoopCounter = 0;
+const uint8_t exampleCustomChar5x8[] = { 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x0 };
+
+void runFullRedraw(void)
+{
+	for (uint8_t y = 0; y < 4; y++)
+	{
+		display->setCursorToPosition(0, y);
+		display->displayData("ABCDEFGHIJKLMNOPQRST");
+	}
+}
+
+void runEraseLines(void)
+{
+	for (uint8_t y = 0; y < 4; y++) display->eraseLine(y);
+}
+
+void runCGRAMUpload(void)
+{
+	for (uint8_t i = 0; i < 8; i++) display->write5x8CharDataToCGRAM(i, exampleCustomChar5x8);
+}
+
+void runDDRAMRead(void)
+{
+	for (uint8_t y = 0; y < 4; y++)
+	{
+		for (uint8_t x = 0; x < 20; x++) display->readDataFromDDRAM(((y & 0x01) ? 0x40 : 0x00) + ((y & 0x02) ? 20 : 0) + x);
+	}
+}
+
+void runBlockRead(void)
+{
+	uint8_t data[20];
+	for (uint8_t y = 0; y < 4; y++) display->readDataFromDDRAM(display->getLineAddress(y), data, 20);
+}
+
+void runDemoLoop(void)//same work as one second of demo sketch
+{
+	frameBuffer->setCursorToPosition(0, 0);
+	frameBuffer->displayData(static_cast<char>(0));
+	frameBuffer->displayData("LCD TEST");
+	frameBuffer->displayData(static_cast<char>(0));
+
+	frameBuffer->setCursorToPosition(0, 1);
+	frameBuffer->displayData("RANDOM CHAR: ");
+	frameBuffer->displayData(static_cast<uint8_t>(random(8, 256)));
+
+	frameBuffer->setCursorToPosition(0, 2);
+	frameBuffer->displayData("RUNTIME: ");
+	PCF8574LCDFormat::printUnsignedNumber(*frameBuffer, demoLoopCounter++, 11);
+
+	frameBuffer->setCursorToPosition(0, 3);
+	frameBuffer->displayData(static_cast<char>(0));
+	frameBuffer->displayData("LCD TEST");
+	frameBuffer->displayData(static_cast<char>(0));
+
+	frameBuffer->flush();
+}
+
+void (*const workloads[workloadsCount])(void) = { runFullRedraw, runEraseLines, runCGRAMUpload, runDDRAMRead, runBlockRead, runDemoLoop };
+
+void printStatistics(const PCF8574LCDStatistics& statistics)//prints counters of one iteration, only when library is built with PCF8574_LCD_STATISTICS=1
+{
+#if PCF8574_LCD_STATISTICS
+	Serial.print("\t");
+	Serial.print(statistics.transmissions / benchmarkRepetitions);
+	Serial.print(" transmissions, ");
+	Serial.print(statistics.writtenBytes / benchmarkRepetitions);
+	Serial.print(" bytes written, ");
+	Serial.print(statistics.reads / benchmarkRepetitions);
+	Serial.print(" reads (");
+	Serial.print(statistics.failedReads / benchmarkRepetitions);
+	Serial.print(" failed), ");
+	Serial.print(statistics.busyFlagPolls / benchmarkRepetitions);
+	Serial.print(" busy flag polls, ");
+	Serial.print(statistics.blockedTime / benchmarkRepetitions);
+	Serial.println(" us blocked");
+#endif
+}
+
+bool exceedsBaseline(const unsigned long& result, const unsigned long& baseline)
+{
+	return result * 100UL > baseline * (100UL + allowedSlowdownPercent);
+}
+
+#if defined(PCF8574_LCD_HOST)
+void printBusCounters(const uint8_t& clockIndex, const uint8_t& modeIndex, const uint8_t& workloadIndex)//prints bus operations of one iteration counted by Wire stand-in
+{
+	unsigned long* counters = busResults[clockIndex][modeIndex][workloadIndex];
+	counters[0] = Wire.getTransmissionsCount() / benchmarkRepetitions;
+	counters[1] = Wire.getBytesCount() / benchmarkRepetitions;
+	counters[2] = Wire.getRequestsCount() / benchmarkRepetitions;
+	const char* const counterNames[3] = { " transmissions, ", " bytes, ", " reads" };
+	const unsigned long* baseline = busBaselines[clockIndex][modeIndex][workloadIndex];
+
+	Serial.print("\t");
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		Serial.print(counters[i]);
+		Serial.print(counterNames[i]);
+	}
+	Serial.print(", baseline ");
+	Serial.print(baseline[0]);
+	Serial.print("/");
+	Serial.print(baseline[1]);
+	Serial.print("/");
+	Serial.print(baseline[2]);
+	if (counters[0] > baseline[0] || counters[1] > baseline[1] || counters[2] > baseline[2]) Serial.println(" REGRESSION");//counts don't vary between runs
+	else Serial.println(" OK");
+}
+
+void printBusBaselines(const unsigned long results[][3])
+{
+	Serial.print("\t{ ");
+	for (uint8_t i = 0; i < workloadsCount; i++)
+	{
+		Serial.print("{ ");
+		Serial.print(results[i][0]);
+		Serial.print(", ");
+		Serial.print(results[i][1]);
+		Serial.print(", ");
+		Serial.print(results[i][2]);
+		Serial.print(i < workloadsCount - 1 ? " }, " : " }");
+	}
+	Serial.println(" }");
+}
+#endif
+
+void runBenchmark(const uint8_t& clockIndex, const uint8_t& modeIndex, unsigned long results[])
+{
+	for (uint8_t i = 0; i < workloadsCount; i++)
+	{
+		display->clearDisplay();
+		frameBuffer->clear();
+		frameBuffer->flush();
+
+		display->resetWindowStatistics();
+#if defined(PCF8574_LCD_HOST)
+		Wire.resetCounters();
+#endif
+		unsigned long startTime = micros();
+		for (uint8_t j = 0; j < benchmarkRepetitions; j++) workloads[i]();
+		results[i] = (micros() - startTime) / benchmarkRepetitions;
+
+		Serial.print(workloadNames[i]);
+		Serial.print(" ");
+		Serial.print(results[i]);
+		Serial.print(" us");
+		if (workloadBytes[i])
+		{
+			Serial.print(", ");
+			Serial.print(workloadBytes[i] * 1000000UL / results[i]);
+			Serial.print(" bytes/s");
+		}
+		Serial.print(", baseline ");
+		Serial.print(baselines[clockIndex][modeIndex][i]);
+		Serial.print(" us");
+		if (exceedsBaseline(results[i], baselines[clockIndex][modeIndex][i])) Serial.println(" REGRESSION");
+		else Serial.println(" OK");
+#if defined(PCF8574_LCD_HOST)
+		printBusCounters(clockIndex, modeIndex, i);
+#endif
+		printStatistics(display->getWindowStatistics());
+	}
+}
+
+void printBaselines(const unsigned long results[])
+{
+	Serial.print("\t{ ");
+	for (uint8_t i = 0; i < workloadsCount; i++)
+	{
+		Serial.print(results[i]);
+		if (i < workloadsCount - 1) Serial.print(", ");
+	}
+	Serial.println(" }");
+}
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+#if defined(PCF8574_LCD_HOST)
+	hostUseVirtualTime(true);//results don't depend on speed of host computer
+	emulator.setBusClock(0);//Wire stand-in advances time by transfer time of bytes, emulator follows it
+	Wire.attachDevice(&emulator);
+#endif
+	Wire.setClock(clocks[0]);
+	Wire.begin();
+	Serial.begin(115200);
+	display = new PCF8574LCDController(PCF8574_DEFAULT_ADDRESS, 20, 4, 0);
+	frameBuffer = new PCF8574LCDFrameBuffer(*display);
+	Serial.println("...PCF8574 LCD Controller Benchmark started...");
+
+	unsigned long results[clocksCount][2][workloadsCount];
+
+	for (uint8_t clock = 0; clock < clocksCount; clock++)
+	{
+		Wire.setClock(clocks[clock]);
+		Serial.print(clocks[clock] / 1000);
+		Serial.println("kHz I2C clock");
+
+		Serial.println("busy flag mode:");
+		display->setBusyCheckMode(PCF8574LCDController::BusyCheckMode::BusyFlag);
+		runBenchmark(clock, 0, results[clock][0]);
+
+		Serial.println("timed mode:");
+		display->setBusyCheckMode(PCF8574LCDController::BusyCheckMode::Timed);
+		runBenchmark(clock, 1, results[clock][1]);
+	}
+
+	Serial.println("baselines for this board:");
+	for (uint8_t clock = 0; clock < clocksCount; clock++)
+	{
+		printBaselines(results[clock][0]);
+		printBaselines(results[clock][1]);
+	}
+
+#if defined(PCF8574_LCD_HOST)
+	Serial.println("bus baselines:");
+	for (uint8_t clock = 0; clock < clocksCount; clock++)
+	{
+		printBusBaselines(busResults[clock][0]);
+		printBusBaselines(busResults[clock][1]);
+	}
+
+	Serial.print("emulator timing violations: ");
+	Serial.println(emulator.getViolationsCount());
+#endif
+}
+
+// the loop function runs over and over again until power down or reset
+void loop() {
+}
@@ -6,8 +6,10 @@
 */
 
 #include "PCF8574LCDController.h"
+#include "PCF8574LCDFrameBuffer.h"
 
 PCF8574LCDController* display = nullptr;
+PCF8574LCDFrameBuffer* frameBuffer = nullptr;
 
 const uint8_t exampleCustomChar5x8[] = { 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x0 };
 // the setup function runs once when you press reset or power the board
@@ -17,6 +19,7 @@ void setup() {
 	Serial.begin(115200);
 	display = new PCF8574LCDController(PCF8574_DEFAULT_ADDRESS, 20, 4, 0);//address of PCF8754(A), number of chars in line, number of lines, font (0 = 5x8, 1 = 5x10), optional LCD controller declaration
 	display->write5x8CharDataToCGRAM(0, exampleCustomChar5x8);//write example custom char to LCD CGRAM
+	frameBuffer = new PCF8574LCDFrameBuffer(*display);//chars are put into frame buffer and only changed ones are sent to display
 	Serial.println("...PCF8574 LCD Controller Demo started...");
 }
 
@@ -24,23 +27,25 @@ void setup() {
 void loop() {
 	if (!(millis() % 1000))//do this every second
 	{
-		display->setCursorToPosition(0, 0);
+		frameBuffer->setCursorToPosition(0, 0);
 
-		display->displayData(static_cast<char>(0));//use custom char number 0
-		display->displayData("LCD TEST");
-		display->displayData(static_cast<char>(0));
+		frameBuffer->displayData(static_cast<char>(0));//use custom char number 0
+		frameBuffer->displayData("LCD TEST");
+		frameBuffer->displayData(static_cast<char>(0));
 
-		display->setCursorToPosition(0, 1);//set cursor to second line
-		display->displayData("RANDOM CHAR: ");
-		display->displayData(static_cast<uint8_t>(random(8, 256)));
+		frameBuffer->setCursorToPosition(0, 1);//set cursor to second line
+		frameBuffer->displayData("RANDOM CHAR: ");
+		frameBuffer->displayData(static_cast<uint8_t>(random(8, 256)));
 
-		display->setCursorToPosition(0, 2);
-		display->displayData("RUNTIME: ");
-		display->displayData(String(millis() / 1000).c_str());
+		frameBuffer->setCursorToPosition(0, 2);
+		frameBuffer->displayData("RUNTIME: ");
+		PCF8574LCDFormat::printUnsignedNumber(*frameBuffer, millis() / 1000, 11);//seconds right-aligned in rest of line, without heap use
 
-		display->setCursorToPosition(0, 3);
-		display->displayData(static_cast<char>(0));//use custom char number 0
-		display->displayData("LCD TEST");
-		display->displayData(static_cast<char>(0));
+		frameBuffer->setCursorToPosition(0, 3);
+		frameBuffer->displayData(static_cast<char>(0));//use custom char number 0
+		frameBuffer->displayData("LCD TEST");
+		frameBuffer->displayData(static_cast<char>(0));
+
+		frameBuffer->flush();//send only chars that changed since last second
 	}
 }
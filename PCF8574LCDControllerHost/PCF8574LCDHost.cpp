@@ -0,0 +1,140 @@
+/*
+ Name:		PCF8574LCDHost.cpp
+ Created:	17/10/2026 02:14:37 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "arduino.h"
+#include "Wire.h"
+#include "PCF8574LCDEmulator.h"
+
+#include <stdio.h>
+#include <time.h>
+
+HardwareSerial Serial;
+TwoWire Wire;
+
+namespace
+{
+	bool virtualTimeEnabled = false;
+	unsigned long virtualTime = 0;
+	unsigned long randomState = 1;
+	PCF8574LCDEmulator* followedDevice = nullptr;
+
+	unsigned long getRealTime(void)
+	{
+		static timespec startTime = {};
+		timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		if (!startTime.tv_sec && !startTime.tv_nsec) startTime = now;
+		return static_cast<unsigned long>((now.tv_sec - startTime.tv_sec) * 1000000LL + (now.tv_nsec - startTime.tv_nsec) / 1000);
+	}
+}
+
+unsigned long micros(void)
+{
+	if (!virtualTimeEnabled) return getRealTime();
+	virtualTime++;//each read takes some time, so waits for given time end
+	return followedDevice == nullptr ? virtualTime : virtualTime + followedDevice->getBusTime();
+}
+
+unsigned long millis(void)
+{
+	return micros() / 1000;
+}
+
+long random(long min, long max)
+{
+	if (max <= min) return min;
+
+	randomState = randomState * 1103515245UL + 12345UL;//same sequence in each run
+	return min + static_cast<long>((randomState >> 16) % static_cast<unsigned long>(max - min));
+}
+
+void hostUseVirtualTime(const bool& enabled)
+{
+	virtualTime = getRealTime();//time never goes back after switch
+	virtualTimeEnabled = enabled;
+}
+
+void hostFollowBusTime(PCF8574LCDEmulator* device)
+{
+	followedDevice = device;
+}
+
+void hostAdvanceTime(const unsigned long& time)
+{
+	virtualTime += time;
+}
+
+size_t Print::print(const unsigned long& number)
+{
+	char digits[11];
+	uint8_t length = 0;
+	unsigned long rest = number;
+
+	do
+	{
+		digits[length++] = '0' + rest % 10;
+		rest /= 10;
+	} while (rest);
+
+	size_t written = 0;
+	while (length) written += write(static_cast<uint8_t>(digits[--length]));
+	return written;
+}
+
+size_t HardwareSerial::write(uint8_t data)
+{
+	if (data == '\r') return 1;//standard output ends lines with \n only
+	return putchar(data) == EOF ? 0 : 1;
+}
+
+void TwoWire::beginTransmission(const uint8_t& address)
+{
+	m_writtenLength = 0;
+	transferBytes(1);//address byte
+	if (m_device != nullptr) m_device->beginTransmission(address);
+}
+
+size_t TwoWire::write(const uint8_t& data)
+{
+	if (m_writtenLength == BUFFER_LENGTH) return 0;//as in Wire, bytes above buffer length are dropped
+
+	m_writtenLength++;
+	transferBytes(1);
+	if (m_device != nullptr) m_device->write(data);
+	return 1;
+}
+
+uint8_t TwoWire::endTransmission(const bool&)
+{
+	m_transmissionsCount++;
+	if (m_device != nullptr) m_device->endTransmission();
+	return 0;
+}
+
+uint8_t TwoWire::requestFrom(const uint8_t& address, const uint8_t& quantity)
+{
+	m_requestsCount++;
+	m_readLength = 0;
+	m_readPosition = 0;
+	transferBytes(1);//address byte
+
+	for (uint8_t i = 0; i < quantity && i < BUFFER_LENGTH; i++)
+	{
+		transferBytes(1);
+		if (m_device == nullptr || !m_device->read(address, m_readBuffer[i])) break;
+		m_readLength++;
+	}
+
+	return m_readLength;
+}
+
+void TwoWire::transferBytes(const uint8_t& bytes)
+{
+	m_bytesCount += bytes;
+	if (virtualTimeEnabled) virtualTime += bytes * 9000000UL / m_clock;//8 bits and acknowledge
+}
@@ -0,0 +1,20 @@
+/*
+ Name:		PCF8574LCDHostSketch.cpp
+ Created:	17/10/2026 02:14:37 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+//Runs sketch given by PCF8574_LCD_HOST_SKETCH (path of .ino file) on host computer: setup is called once and loop is called once,
+//because sketches of this library do all their work in setup.
+
+#include "arduino.h"
+#include PCF8574_LCD_HOST_SKETCH
+
+int main(void)
+{
+	setup();
+	loop();
+	return 0;
+}
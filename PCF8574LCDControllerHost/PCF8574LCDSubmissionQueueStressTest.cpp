@@ -0,0 +1,130 @@
+/*
+ Name:		PCF8574LCDSubmissionQueueStressTest.cpp
+ Created:	17/10/2026 03:52:18 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+//Stress test of submission queue on host computer: producer threads submit numbered text without pause while display thread
+//drains it into frame buffer of emulated display. Text rejected by full queue is submitted again, so every text must be drained once,
+//every rejection must be counted as dropped, last text of each producer must be on screen and display must receive no instruction
+//too early. Returns non-zero exit code on failure.
+
+#include "PCF8574LCDEmulator.h"
+#include "PCF8574LCDSubmissionQueue.h"
+
+#include <stdio.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+PCF8574LCDEmulator emulator(20, 4, PCF8574_DEFAULT_ADDRESS);
+
+typedef PCF8574StaticLCDController<20, 4, 0, PCF8574LCDDriverType::HD44780, PCF8574EmulatorTransport<emulator>> EmulatedLCDController;
+typedef BasicPCF8574LCDFrameBuffer<EmulatedLCDController> EmulatedFrameBuffer;
+
+const uint8_t producersCount = 4;
+const unsigned long textsPerProducer = 50000;
+const uint8_t textLength = 8;//each text is one record of queue below, so every submit is drained whole or dropped whole
+
+bool check(const bool& condition, const char message[])
+{
+	if (!condition) printf("FAILED: %s\n", message);
+	return condition;
+}
+
+bool runStressTest(EmulatedFrameBuffer& frameBuffer)
+{
+	PCF8574LCDSubmissionQueue<EmulatedFrameBuffer, 16, textLength> queue(frameBuffer);
+	std::atomic<unsigned long> rejectedSubmits(0);
+	std::atomic<bool> producersFinished(false);
+	std::vector<std::thread> producers;
+
+	for (uint8_t id = 0; id < producersCount; id++)
+	{
+		producers.emplace_back([&queue, &rejectedSubmits, id]
+		{
+			char text[16];
+			for (unsigned long i = 1; i <= textsPerProducer; i++)
+			{
+				snprintf(text, sizeof(text), "%u%07lu", id, i);
+				while (!queue.submit(0, id, text, textLength))
+				{
+					rejectedSubmits++;
+					std::this_thread::sleep_for(std::chrono::microseconds(50));//display thread needs time to drain
+				}
+			}
+		});
+	}
+
+	unsigned long drainedRecords = 0;
+	std::thread display([&]
+	{
+		for (;;)
+		{
+			bool finished = producersFinished.load();//read before drain, so records submitted before finish are drained
+			drainedRecords += queue.drain();
+			frameBuffer.flush();
+			if (finished) return;
+		}
+	});
+
+	for (std::thread& producer : producers) producer.join();
+	producersFinished = true;
+	display.join();
+
+	printf("%lu texts drained, %lu submits rejected\n", drainedRecords, rejectedSubmits.load());
+
+	bool passed = check(drainedRecords == producersCount * textsPerProducer, "submitted texts were lost or drained twice");
+	passed &= check(queue.getDroppedCount() == rejectedSubmits, "rejected submits weren't counted as dropped");
+	for (uint8_t id = 0; id < producersCount; id++)
+	{
+		char expected[16];
+		char line[21];
+		snprintf(expected, sizeof(expected), "%u%07lu", id, textsPerProducer);
+		emulator.getScreenLine(id, line);
+		printf("|%s|\n", line);
+		passed &= check(!memcmp(line, expected, textLength), "last text of producer isn't on screen");
+	}
+
+	return passed;
+}
+
+bool runLongTextTest(EmulatedFrameBuffer& frameBuffer)
+{
+	PCF8574LCDSubmissionQueue<EmulatedFrameBuffer, 16, 20> queue(frameBuffer);
+	char text[255];
+	for (uint8_t i = 0; i < sizeof(text); i++) text[i] = 'A' + i % 26;
+
+	bool passed = check(queue.submit(0, 0, text, sizeof(text)), "text of 255 chars wasn't submitted");//offset of last record passes 255
+	passed &= check(queue.drain() == 13, "text of 255 chars wasn't split into 13 records");
+	frameBuffer.flush();
+
+	for (uint8_t i = 0; i < 12; i++) queue.submit(0, 1, text, 20);//leaves space for 4 records
+	passed &= check(!queue.submit(0, 1, text, 120), "text of 6 records was submitted into space for 4 records");
+	passed &= check(queue.getDroppedCount() == 2, "remaining records of partially submitted text weren't counted as dropped");
+	passed &= check(queue.drain() == 16, "records submitted before queue was full were lost");
+	frameBuffer.flush();
+
+	char line[21];
+	emulator.getScreenLine(0, line);
+	return passed & check(!memcmp(line, text, 20), "text of 255 chars isn't on screen");
+}
+
+int main(void)
+{
+	hostUseVirtualTime(true);
+	hostFollowBusTime(&emulator);
+	emulator.powerOn();
+
+	EmulatedLCDController display(PCF8574_DEFAULT_ADDRESS, PCF8574LCDBusyCheckMode::Timed);
+	EmulatedFrameBuffer frameBuffer(display);
+
+	bool passed = runLongTextTest(frameBuffer);
+	passed &= runStressTest(frameBuffer);
+	passed &= check(!emulator.getViolationsCount(), "display received instructions too early");
+
+	printf(passed ? "PASSED\n" : "FAILED\n");
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+/*
+ Name:		Wire.h
+ Created:	17/10/2026 02:14:37 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+//Stand-in for Arduino Wire library on host computer. Transmissions are counted and may be passed to emulated display,
+//and with virtual time each byte on bus advances time by its transfer time at clock set by setClock.
+
+#ifndef _PCF8574LCDHostWire_h
+#define _PCF8574LCDHostWire_h
+
+#include "arduino.h"
+
+#define BUFFER_LENGTH 32
+
+class PCF8574LCDEmulator;
+
+/// <summary>
+/// I2C bus of host computer.
+/// </summary>
+class TwoWire final
+{
+public:
+	void begin(void) {}
+
+	/// <summary>
+	/// Sets clock of bus, which gives transfer time of bytes.
+	/// </summary>
+	/// <param name="clock">Clock in Hz</param>
+	void setClock(const unsigned long& clock) { m_clock = clock; }
+
+	void beginTransmission(const uint8_t& address);
+	size_t write(const uint8_t& data);
+	uint8_t endTransmission(const bool& sendStop = true);
+	uint8_t requestFrom(const uint8_t& address, const uint8_t& quantity);
+	int available(void) { return m_readLength - m_readPosition; }
+	int read(void) { return m_readPosition < m_readLength ? m_readBuffer[m_readPosition++] : -1; }
+
+	/// <summary>
+	/// Connects emulated display to bus. Without device all transmissions are acknowledged and reads return nothing.
+	/// </summary>
+	/// <param name="device">Emulator, nullptr to disconnect</param>
+	void attachDevice(PCF8574LCDEmulator* device) { m_device = device; }
+
+	/// <summary>
+	/// Returns number of transmissions (beginTransmission and endTransmission pairs) since last reset.
+	/// </summary>
+	/// <returns>Transmissions count</returns>
+	unsigned long getTransmissionsCount(void) { return m_transmissionsCount; }
+
+	/// <summary>
+	/// Returns number of bytes on bus since last reset, with address bytes of transmissions and reads.
+	/// </summary>
+	/// <returns>Bytes count</returns>
+	unsigned long getBytesCount(void) { return m_bytesCount; }
+
+	/// <summary>
+	/// Returns number of requestFrom calls since last reset.
+	/// </summary>
+	/// <returns>Reads count</returns>
+	unsigned long getRequestsCount(void) { return m_requestsCount; }
+
+	/// <summary>
+	/// Returns transfer time of bytes counted since last reset: 8 bits and acknowledge for each byte, start and stop conditions are omitted.
+	/// </summary>
+	/// <param name="clock">Clock of bus in Hz</param>
+	/// <returns>Time in microseconds</returns>
+	unsigned long getBusTime(const unsigned long& clock) { return static_cast<unsigned long>(m_bytesCount * 9000000ULL / clock); }
+
+	/// <summary>
+	/// Clears counters.
+	/// </summary>
+	void resetCounters(void) { m_transmissionsCount = 0; m_bytesCount = 0; m_requestsCount = 0; }
+
+private:
+	/// <summary>
+	/// Counts bytes and advances virtual time by their transfer time.
+	/// </summary>
+	/// <param name="bytes">Number of bytes</param>
+	void transferBytes(const uint8_t& bytes);
+
+	PCF8574LCDEmulator* m_device = nullptr;
+	unsigned long m_clock = 100000;
+	uint8_t m_writtenLength = 0;
+	uint8_t m_readBuffer[BUFFER_LENGTH] = {};
+	uint8_t m_readLength = 0;
+	uint8_t m_readPosition = 0;
+	unsigned long m_transmissionsCount = 0;
+	unsigned long m_bytesCount = 0;
+	unsigned long m_requestsCount = 0;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ Name:		arduino.h
+ Created:	17/10/2026 02:14:37 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+//Minimal stand-in for Arduino core, so library, emulator and sketches without hardware access can be built on host computer.
+//Only parts of Arduino API used by this library and its sketches are provided.
+
+#ifndef _PCF8574LCDHostArduino_h
+#define _PCF8574LCDHostArduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+
+#define PROGMEM
+#define PGM_P const char*
+#define strlen_P strlen
+#define memcpy_P memcpy
+
+class __FlashStringHelper;
+#define F(string) (reinterpret_cast<const __FlashStringHelper*>(string))
+
+inline uint8_t pgm_read_byte(const void* address) { return *static_cast<const uint8_t*>(address); }
+inline uint16_t pgm_read_word(const void* address) { return *static_cast<const uint16_t*>(address); }
+inline const void* pgm_read_ptr(const void* address) { return *static_cast<const void* const*>(address); }
+
+/// <summary>
+/// Returns time since start of program in microseconds. With virtual time it is advanced only by hostAdvanceTime
+/// and by one microsecond on each call, so loops waiting for given time always end.
+/// </summary>
+/// <returns>Time in microseconds</returns>
+unsigned long micros(void);
+
+/// <summary>
+/// Returns time since start of program in milliseconds.
+/// </summary>
+/// <returns>Time in milliseconds</returns>
+unsigned long millis(void);
+
+/// <summary>
+/// Returns pseudo-random number. Sequence is the same in each run of program.
+/// </summary>
+/// <param name="min">Lowest returned value</param>
+/// <param name="max">Highest returned value plus one</param>
+/// <returns>Number from given range</returns>
+long random(long min, long max);
+
+/// <summary>
+/// Switches between real time of host computer and virtual time, which doesn't depend on speed of host computer. Host only.
+/// </summary>
+/// <param name="enabled">True = virtual time</param>
+void hostUseVirtualTime(const bool& enabled);
+
+/// <summary>
+/// Advances virtual time, for example by transfer time of bytes sent over I2C bus. Real time isn't changed. Host only.
+/// </summary>
+/// <param name="time">Time in microseconds</param>
+void hostAdvanceTime(const unsigned long& time);
+
+class PCF8574LCDEmulator;
+
+/// <summary>
+/// Adds transfer time counted by emulator to virtual time, for emulator reached without Wire, like fake device of PCF8574LinuxI2cBus. Host only.
+/// </summary>
+/// <param name="device">Emulator, nullptr to stop following it</param>
+void hostFollowBusTime(PCF8574LCDEmulator* device);
+
+/// <summary>
+/// Base of classes printing text, as in Arduino core.
+/// </summary>
+class Print
+{
+public:
+	virtual size_t write(uint8_t data) = 0;
+	virtual size_t write(const uint8_t* buffer, size_t size) { size_t written = 0; while (size--) written += write(*buffer++); return written; }
+	size_t write(const char* text) { return text == nullptr ? 0 : write(reinterpret_cast<const uint8_t*>(text), strlen(text)); }
+	virtual void flush(void) {}
+
+	size_t print(const char* text) { return write(text); }
+	size_t print(const __FlashStringHelper* text) { return write(reinterpret_cast<const char*>(text)); }
+	size_t print(const char& data) { return write(static_cast<uint8_t>(data)); }
+	size_t print(const unsigned long& number);
+	size_t print(const long& number) { return number < 0 ? write(static_cast<uint8_t>('-')) + print(0UL - static_cast<unsigned long>(number)) : print(static_cast<unsigned long>(number)); }
+	size_t print(const unsigned int& number) { return print(static_cast<unsigned long>(number)); }
+	size_t print(const int& number) { return print(static_cast<long>(number)); }
+	size_t print(const uint8_t& number) { return print(static_cast<unsigned long>(number)); }
+
+	size_t println(void) { return write("\r\n"); }
+	template<typename T>
+	size_t println(const T& data) { size_t written = print(data); return written + println(); }
+
+	virtual ~Print(void) {}
+};
+
+/// <summary>
+/// Serial port writing to standard output.
+/// </summary>
+class HardwareSerial final : public Print
+{
+public:
+	void begin(const unsigned long&) {}
+	size_t write(uint8_t data) override;
+	using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,131 @@
+/*
+ Name:		PCF8574LCDControllerLinuxBenchmark.ino
+ Created:	17/10/2026 01:26:03 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+*/
+
+//Benchmark for Linux single board computers with Arduino API layer. Counts I2C_RDWR system calls per char of typical workloads
+//with one system call for each transmission (direct mapping of Wire) and with batches of messages.
+//By default emulator is used as fake I2C device, so benchmark runs on any Linux computer, set devicePath to use real display.
+//Host build (CMakeLists.txt in main directory) runs it with virtual time following transfer time of emulated 100kHz bus and reports timing violations.
+
+#include "PCF8574LCDLinuxTransport.h"
+
+const char* const devicePath = nullptr;//for example "/dev/i2c-1", nullptr = fake device
+
+PCF8574LCDEmulator emulator(20, 4, PCF8574_DEFAULT_ADDRESS);
+PCF8574LinuxI2cBus bus;
+
+typedef BasicPCF8574LCDController<PCF8574LinuxI2cTransport<bus>> LinuxLCDController;
+LinuxLCDController* display = nullptr;
+
+const uint8_t benchmarkRepetitions = 10;//each workload is repeated this many times and average is reported
+
+const uint8_t workloadsCount = 4;
+const char* const workloadNames[workloadsCount] = { "full redraw ", "erase lines ", "CGRAM upload", "block read  " };
+const uint16_t workloadChars[workloadsCount] = { 80, 80, 64, 80 };//chars or CGRAM bytes moved by one iteration
+
+const uint8_t exampleCustomChar5x8[] = { 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x0 };
+
+void runFullRedraw(void)
+{
+	for (uint8_t y = 0; y < 4; y++)
+	{
+		display->setCursorToPosition(0, y);
+		display->displayData("ABCDEFGHIJKLMNOPQRST");
+	}
+}
+
+void runEraseLines(void)
+{
+	for (uint8_t y = 0; y < 4; y++) display->eraseLine(y);
+}
+
+void runCGRAMUpload(void)
+{
+	for (uint8_t i = 0; i < 8; i++) display->write5x8CharDataToCGRAM(i, exampleCustomChar5x8);
+}
+
+void runBlockRead(void)
+{
+	uint8_t data[20];
+	for (uint8_t y = 0; y < 4; y++) display->readDataFromDDRAM(display->getLineAddress(y), data, 20);
+}
+
+void (*const workloads[workloadsCount])(void) = { runFullRedraw, runEraseLines, runCGRAMUpload, runBlockRead };
+
+void runBenchmark(const bool& batching)
+{
+	bus.setBatching(batching);
+
+	for (uint8_t i = 0; i < workloadsCount; i++)
+	{
+		display->clearDisplay();
+		display->sendBufferedData();
+
+		bus.resetCounters();
+		unsigned long startTime = micros();
+		for (uint8_t j = 0; j < benchmarkRepetitions; j++) workloads[i]();
+		display->sendBufferedData();
+		unsigned long time = (micros() - startTime) / benchmarkRepetitions;
+
+		Serial.print(workloadNames[i]);
+		Serial.print(" ");
+		Serial.print(time);
+		Serial.print(" us, ");
+		Serial.print(bus.getSystemCallsCount());
+		Serial.print(" system calls for ");
+		Serial.print(benchmarkRepetitions * workloadChars[i]);
+		Serial.print(" chars, ");
+		Serial.print(bus.getSystemCallsCount() * 1000UL / (benchmarkRepetitions * workloadChars[i]));
+		Serial.print(" system calls per 1000 chars");
+		if (bus.getFailedSystemCallsCount()) Serial.print(", FAILED");
+		Serial.println();
+	}
+}
+
+// the setup function runs once when program starts
+void setup() {
+	Serial.begin(115200);
+
+	if (devicePath == nullptr)
+	{
+#if defined(PCF8574_LCD_HOST)
+		hostUseVirtualTime(true);//fake device takes no time, so time of host follows transfer time of emulated bus, as with real display
+		hostFollowBusTime(&emulator);
+#endif
+		bus.openFakeDevice(emulator);
+	}
+	else if (!bus.open(devicePath))
+	{
+		Serial.println("I2C bus can't be opened");
+		return;
+	}
+
+	display = new LinuxLCDController(PCF8574_DEFAULT_ADDRESS, 20, 4, 0);
+	Serial.println("...PCF8574 LCD Controller Linux Benchmark started...");
+
+	const LinuxLCDController::BusyCheckMode modes[2] = { LinuxLCDController::BusyCheckMode::BusyFlag, LinuxLCDController::BusyCheckMode::Timed };
+	for (uint8_t mode = 0; mode < 2; mode++)
+	{
+		display->setBusyCheckMode(modes[mode]);
+
+		Serial.println(mode ? "timed mode, system call for each transmission:" : "busy flag mode, system call for each transmission:");
+		runBenchmark(false);
+		Serial.println(mode ? "timed mode, batches of transmissions:" : "busy flag mode, batches of transmissions:");
+		runBenchmark(true);
+	}
+
+#if defined(PCF8574_LCD_HOST)
+	if (devicePath == nullptr)
+	{
+		Serial.print("emulator timing violations: ");
+		Serial.println(emulator.getViolationsCount());
+	}
+#endif
+}
+
+// the loop function runs over and over again until program is stopped
+void loop() {
+}